@@ -0,0 +1,60 @@
+// Times the nightly stat kernel on every instruction set the CPU supports and checks that they
+// all leave identical columns behind.
+//
+// usage: zooperator_kernel_bench [lane count] [nights]   (defaults to 1000000 100)
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nightly_kernel.h"
+
+int main(int argc, char* argv[]) {
+  size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  int nights = argc > 2 ? std::stoi(argv[2]) : 100;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> stat(0, 100);
+  std::uniform_int_distribution<int> species(0, SPECIES_COUNT - 1);
+  std::uniform_int_distribution<int> placement(0, 2);
+  std::vector<int> initial(4 * count);
+  for (int& value : initial) {
+    value = stat(rng);
+  }
+  std::vector<Species> species_column(count);
+  std::vector<Placement> placement_column(count);
+  for (size_t i = 0; i < count; ++i) {
+    species_column[i] = static_cast<Species>(species(rng));
+    placement_column[i] = static_cast<Placement>(placement(rng));
+  }
+
+  std::vector<int> baseline;
+  bool identical = true;
+  for (KernelIsa isa : {KernelIsa::SCALAR, KernelIsa::SSE41, KernelIsa::AVX2}) {
+    if (!kernelIsaSupported(isa)) {
+      continue;
+    }
+    std::vector<int> stats = initial;
+    NightlyLanes lanes{stats.data(), stats.data() + count, stats.data() + 2 * count,
+                       stats.data() + 3 * count, species_column.data(), placement_column.data(),
+                       count};
+    auto start = std::chrono::steady_clock::now();
+    for (int night = 0; night < nights; ++night) {
+      runNightlyKernel(lanes, isa);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count() / nights;
+    std::cout << kernelIsaName(isa) << ": " << ms << " ms per night over " << count
+              << " animals\n";
+
+    if (baseline.empty()) {
+      baseline = stats;
+    } else if (stats != baseline) {
+      std::cout << kernelIsaName(isa) << " diverged from scalar\n";
+      identical = false;
+    }
+  }
+  return identical ? 0 : 1;
+}
@@ -0,0 +1,45 @@
+// Sells and re-buys animals in a warmed-up zoo and checks that the steady state makes no
+// system allocations for game objects.
+//
+// usage: zooperator_pool_bench [animal count] [churn count]   (defaults to 100000 1000000)
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "object_pool.h"
+#include "penguin.h"
+#include "rabbit.h"
+#include "zoo.h"
+
+int main(int argc, char* argv[]) {
+  size_t animal_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t churn_count = argc > 2 ? std::stoul(argv[2]) : 1000000;
+
+  Zoo zoo("Bench Zoo", 1e15);
+
+  // silence purchase and sale messages
+  NullEventSink sink;
+  zoo.setEventSink(sink);
+
+  for (size_t i = 0; i < animal_count; ++i) {
+    zoo.purchaseAnimal(std::make_unique<Rabbit>("Miffy", 2));
+  }
+
+  PoolStats warm = poolStats();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < churn_count; ++i) {
+    zoo.sellAnimal(zoo.animalView().back());
+    zoo.purchaseAnimal(std::make_unique<Penguin>("Pororo", 3));
+  }
+  auto end = std::chrono::steady_clock::now();
+  PoolStats after = poolStats();
+
+  uint64_t chunks = after.chunk_allocations - warm.chunk_allocations;
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / churn_count;
+  std::cout << churn_count << " sell/purchase pairs over " << animal_count << " animals: " << ns
+            << " ns per pair, " << (after.allocations - warm.allocations)
+            << " pooled allocations, " << chunks << " system allocations\n";
+  return chunks == 0 ? 0 : 1;
+}
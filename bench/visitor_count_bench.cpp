@@ -0,0 +1,222 @@
+// Times Zoo::calculateVisitorCount against the original multi-loop implementation at several
+// zoo sizes and checks that both produce the same count.
+//
+// usage: zooperator_bench [animal counts...]   (defaults to 1000 100000 1000000)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "bear.h"
+#include "elephant.h"
+#include "exhibit.h"
+#include "lion.h"
+#include "monkey.h"
+#include "penguin.h"
+#include "rabbit.h"
+#include "tortoise.h"
+#include "zoo.h"
+
+static std::unique_ptr<Animal> makeAnimal(int kind, const std::string& name) {
+  switch (kind) {
+    case 0:
+      return std::make_unique<Lion>(name, 5);
+    case 1:
+      return std::make_unique<Bear>(name, 5);
+    case 2:
+      return std::make_unique<Elephant>(name, 5);
+    case 3:
+      return std::make_unique<Monkey>(name, 5);
+    case 4:
+      return std::make_unique<Penguin>(name, 5);
+    case 5:
+      return std::make_unique<Rabbit>(name, 5);
+    default:
+      return std::make_unique<Tortoise>(name, 5);
+  }
+}
+
+static void populate(Zoo& zoo, size_t animal_count, std::mt19937& rng) {
+  std::uniform_int_distribution<int> kind(0, 6);
+  std::uniform_int_distribution<int> delta(-100, 100);
+
+  for (size_t i = 0; i < animal_count; ++i) {
+    zoo.purchaseAnimal(makeAnimal(kind(rng), "A" + std::to_string(i)));
+  }
+  for (Animal* animal : zoo.getAllAnimals()) {
+    animal->updateHealth(delta(rng) / 2);
+    animal->updateHunger(delta(rng));
+    animal->updateHappiness(delta(rng) / 2);
+    animal->updateEnergy(delta(rng) / 2);
+  }
+
+  size_t exhibit_count = std::max<size_t>(1, animal_count / 100);
+  for (size_t i = 0; i < exhibit_count; ++i) {
+    zoo.purchaseExhibit(std::make_unique<Exhibit>("E" + std::to_string(i), "Forest", 4, 1.0, 1.0));
+  }
+  for (Exhibit* exhibit : zoo.getAllExhibits()) {
+    exhibit->updateCleanliness(-std::abs(delta(rng)));
+  }
+}
+
+// the original implementation: a full rating pass, then one loop per visitor factor
+static double referenceRating(Zoo& zoo) {
+  double happiness_score = 0.0;
+  double health_score = 0.0;
+  if (zoo.getAnimalCount() > 0) {
+    double total_happiness = 0.0;
+    for (Animal* animal : zoo.getAllAnimals()) {
+      total_happiness += animal->getHappinessLevel();
+    }
+    happiness_score = (total_happiness / zoo.getAnimalCount() / 100.0) * 2.5;
+
+    double total_health = 0.0;
+    for (Animal* animal : zoo.getAllAnimals()) {
+      total_health += animal->getHealthLevel();
+    }
+    health_score = (total_health / zoo.getAnimalCount() / 100.0) * 1.5;
+  }
+
+  double cleanliness_score = 0.5;
+  if (zoo.getExhibitCount() > 0) {
+    double total_cleanliness = 0.0;
+    for (Exhibit* exhibit : zoo.getAllExhibits()) {
+      total_cleanliness += exhibit->getCleanliness();
+    }
+    cleanliness_score = (total_cleanliness / zoo.getExhibitCount() / 100.0) * 0.75;
+  }
+
+  double expenses = 30.0 + zoo.getAnimalCount() * 8.0 + zoo.getExhibitCount() * 5.0;
+  for (Animal* animal : zoo.getAllAnimals()) {
+    expenses += animal->getMaintenanceCost();
+  }
+  for (Exhibit* exhibit : zoo.getAllExhibits()) {
+    expenses += exhibit->getMaintenanceCost();
+  }
+  double projected_balance =
+      zoo.getBalance() + zoo.calculateDailyRevenue(static_cast<int>(zoo.getAnimalCount() * 5)) -
+      expenses;
+
+  double financial_score = 0.0;
+  if (projected_balance > 3000) {
+    financial_score = 0.25;
+  } else if (projected_balance > 1500) {
+    financial_score = 0.15;
+  } else if (projected_balance > 500) {
+    financial_score = 0.05;
+  }
+
+  double total = happiness_score + health_score + cleanliness_score + financial_score;
+  return std::max(0.0, std::min(5.0, total));
+}
+
+static int referenceVisitorCount(Zoo& zoo) {
+  int base_visitors = static_cast<int>(zoo.getAnimalCount()) * 5;
+
+  double rating = referenceRating(zoo);
+  double multiplier = rating >= 4.0   ? 2.0
+                      : rating >= 3.5 ? 1.5
+                      : rating >= 3.0 ? 1.0
+                      : rating >= 2.5 ? 0.7
+                      : rating >= 2.0 ? 0.4
+                                      : 0.2;
+  int visitors = static_cast<int>(base_visitors * multiplier);
+
+  std::set<std::string> species;
+  for (Animal* animal : zoo.getAllAnimals()) {
+    species.insert(animal->getSpecies());
+  }
+
+  int rarity_bonus = 0;
+  for (Animal* animal : zoo.getAllAnimals()) {
+    if (animal->getSpecies() == "Elephant") {
+      rarity_bonus += 6;
+    } else if (animal->getSpecies() == "Bear" || animal->getSpecies() == "Lion") {
+      rarity_bonus += 4;
+    } else if (animal->getSpecies() == "Monkey" || animal->getSpecies() == "Penguin") {
+      rarity_bonus += 2;
+    }
+  }
+
+  int happiness_bonus = 0;
+  for (Animal* animal : zoo.getAllAnimals()) {
+    if (animal->getHappinessLevel() > 80) {
+      happiness_bonus += 2;
+    }
+  }
+
+  int neglect_penalty = 0;
+  for (Animal* animal : zoo.getAllAnimals()) {
+    if (animal->needsAttention()) {
+      neglect_penalty += 3;
+    }
+  }
+
+  int cleanliness_penalty = 0;
+  for (Exhibit* exhibit : zoo.getAllExhibits()) {
+    if (exhibit->needsCleaning()) {
+      cleanliness_penalty += 2;
+    }
+  }
+
+  int final_visitors = visitors + rarity_bonus + static_cast<int>(species.size()) +
+                       happiness_bonus - neglect_penalty - cleanliness_penalty;
+  return final_visitors < 0 ? 0 : final_visitors;
+}
+
+// best-of-n wall time of one call, in microseconds
+template <typename F>
+static double timeBest(int repetitions, F&& f) {
+  double best = 1e300;
+  for (int i = 0; i < repetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  return best;
+}
+
+int main(int argc, char* argv[]) {
+  std::vector<size_t> sizes;
+  for (int i = 1; i < argc; ++i) {
+    sizes.push_back(std::stoul(argv[i]));
+  }
+  if (sizes.empty()) {
+    sizes = {1000, 100000, 1000000};
+  }
+
+  bool all_match = true;
+  for (size_t size : sizes) {
+    Zoo zoo("Bench Zoo", 1e12);
+    std::mt19937 rng(static_cast<unsigned>(size));
+
+    // silence purchase messages while populating
+    NullEventSink sink;
+    zoo.setEventSink(sink);
+    populate(zoo, size, rng);
+
+    int repetitions = size >= 1000000 ? 3 : 10;
+    int reference = 0;
+    int fused = 0;
+    double reference_us = timeBest(repetitions, [&] { reference = referenceVisitorCount(zoo); });
+    double fused_us = timeBest(repetitions, [&] {
+      zoo.addMoney(0.0);  // bump the epoch so the metrics are recomputed
+      fused = zoo.calculateVisitorCount();
+    });
+    double cached_us = timeBest(repetitions, [&] { fused = zoo.calculateVisitorCount(); });
+
+    bool match = reference == fused;
+    all_match = all_match && match;
+    std::cout << size << " animals: reference " << reference_us << " us, fused " << fused_us
+              << " us, cached " << cached_us << " us, visitors " << fused
+              << (match ? "" : " MISMATCH") << "\n";
+  }
+  return all_match ? 0 : 1;
+}
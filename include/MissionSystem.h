@@ -6,28 +6,58 @@
 #include <vector>
 
 #include "animal.h"
+#include "campaign.h"
 #include "exhibit.h"
+#include "handles.h"
 #include "mission.h"
+#include "predicate.h"
+#include "screen_buffer.h"
 #include "zoo.h"
 
+// The zoo figures missions are judged on, gathered once and shared by checking, progress
+// display and the impossibility check instead of each mission scanning the zoo again.
+struct MissionContext {
+  size_t animals = 0;
+  size_t exhibits = 0;
+  SpeciesMask species = 0;
+  size_t homeless = 0;
+  size_t misplaced = 0;  // housed outside their preferred habitat
+  size_t sick = 0;
+  size_t needy = 0;  // Animal::needsAttention
+  int min_cleanliness = 0;
+  size_t dirty = 0;  // Exhibit::needsCleaning
+  double balance = 0.0;
+};
+
 class MissionSystem {
  public:
-  explicit MissionSystem(Zoo& zoo);
+  // the campaign must outlive the mission system
+  explicit MissionSystem(Zoo& zoo, const Campaign& campaign = standardCampaign());
   MissionSystem() = delete;
 
   std::vector<Mission>& getMissions();
+  const std::vector<Mission>& getMissions() const;
   std::set<Animal*> getAnimalsFedToday();
   std::set<Exhibit*> getExhibitsCleanedToday();
+  // the same ids without copying, they stay counted after the animal or exhibit is sold
+  const AnimalIdSet& animalsFedToday() const;
+  const ExhibitIdSet& exhibitsCleanedToday() const;
 
-  // mission setup
+  // mission setup, switching campaigns sets up the current day's missions from the new one
+  void setCampaign(const Campaign& campaign);
+  int getDayCount() const;
   void setupDailyMissions(int day);
   void checkMissions(bool end_of_day);
   void completeMission(size_t mission_index);
   bool canAdvanceDay();
+  // true when the required missions left can no longer all be met today, see
+  // requiredMissionsFeasible
   bool checkMissionsImpossible(int action_points);
 
   void displayMissions(bool show_status);
+  void renderMissions(ScreenBuffer& screen, bool show_status);
   std::string getMissionProgress(const Mission& mission);
+  MissionContext makeContext() const;
 
   // daily tracking
   void trackAnimalFed(Animal* animal);
@@ -37,11 +67,17 @@ class MissionSystem {
   void resetDailyTracking();
 
  private:
+  std::string getMissionProgress(const Mission& mission, const MissionContext& context);
+  MissionVars makeVars(const MissionContext& context, bool with_metrics) const;
+
   Zoo& zoo_;
+  const Campaign* campaign_;
   std::vector<Mission> missions_;
 
-  std::set<Animal*> animals_fed_today_;
-  std::set<Exhibit*> exhibits_cleaned_today_;
+  // bitsets over id indices; a sold animal or exhibit stays counted for the day, even once a
+  // later purchase reuses its index
+  AnimalIdSet animals_fed_today_;
+  ExhibitIdSet exhibits_cleaned_today_;
   bool played_with_animal_today_ = false;
   bool exercised_animal_today_ = false;
 };
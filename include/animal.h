@@ -1,25 +1,38 @@
 #ifndef ANIMAL_H
 #define ANIMAL_H
 
+#include <array>
 #include <string>
+#include <string_view>
 
+#include "animal_store.h"
+#include "event_sink.h"
+#include "object_pool.h"
+#include "species.h"
+
+// Costs, nightly decay, habitat and sound all come from the species' row in SPECIES_TRAITS.
+// The per-species subclasses only pick the row.
 class Animal {
  public:
-  Animal(std::string name, std::string species, int age);
+  Animal(std::string name, Species species, int age);
   virtual ~Animal() = default;
 
-  // prevent copying since animals are unique, allow moving
+  // animals are allocated from size-class pools, see object_pool.h
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size) noexcept;
+
+  // prevent copying and moving since animals are unique and stores hold pointers to them
   Animal(const Animal&) = delete;             // copy constructor
   Animal& operator=(const Animal&) = delete;  // copy assignment operator
-  Animal(Animal&&) = default;                 // move constructor
-  Animal& operator=(Animal&&) = default;      // move assignment operator
+  Animal(Animal&&) = delete;                  // move constructor
+  Animal& operator=(Animal&&) = delete;       // move assignment operator
 
   // core behaviors
   virtual void eat(int amount);
   virtual void sleep();
-  virtual void makeSound() const = 0;
-  virtual void updateStatsEndOfDay() = 0;
-  virtual std::string getPreferredHabitat() const = 0;
+  virtual void makeSound() const;
+  DailyDecay getDailyDecay() const;
+  void updateStatsEndOfDay();
   void receivePlay();
   void receiveExercise();
   void receiveTreatment();
@@ -27,6 +40,11 @@ class Animal {
   // getters
   const std::string& getName() const;
   const std::string& getSpecies() const;
+  Species getSpeciesId() const;
+  const SpeciesTraits& getTraits() const;
+  Habitat getHabitat() const;
+  std::string_view getPreferredHabitat() const;
+  AnimalId getId() const;
   int getAge() const;
   int getHealthLevel() const;
   int getHungerLevel() const;
@@ -35,6 +53,9 @@ class Animal {
   bool isAlive() const;
   bool needsAttention() const;
 
+  // the owning store's sink, or the console sink while the animal is not in a store
+  EventSink& eventSink() const;
+
   double getPurchaseCost() const;
   double getFeedingCost() const;
   double getMaintenanceCost() const;
@@ -46,29 +67,36 @@ class Animal {
   void updateEnergy(int delta);
   void setName(const std::string& name);
 
+  // consts
+  static constexpr int MIN_STAT = 0;
+  static constexpr int MAX_STAT = 100;
+  static constexpr int CRITICAL_THRESHOLD = 20;
+
  protected:
   // basic info
   std::string name_;
-  std::string species_;
+  Species species_id_;
   int age_;
 
-  // stats
-  int health_;
-  int hunger_;
-  int happiness_;
-  int energy_;
-
   // costs
   double purchase_cost_;
   double feeding_cost_;
   double maintenance_cost_;
 
-  // consts
-  static constexpr int MIN_STAT = 0;
-  static constexpr int MAX_STAT = 100;
-  static constexpr int CRITICAL_THRESHOLD = 20;
-
   static int clamp(int value, int min_val, int max_val);
+
+ private:
+  friend class AnimalStore;
+
+  int getStat(AnimalStat stat) const;
+  void updateStat(AnimalStat stat, int delta);
+
+  // stats, only used while the animal is not in a store
+  std::array<int, ANIMAL_STAT_COUNT> stats_;
+
+  AnimalStore* store_ = nullptr;
+  size_t slot_ = 0;
+  AnimalId id_;
 };
 
 #endif  // ANIMAL_H
@@ -0,0 +1,208 @@
+#ifndef ANIMAL_STORE_H
+#define ANIMAL_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <span>
+#include <vector>
+
+#include "event_sink.h"
+#include "handles.h"
+#include "nightly_kernel.h"
+#include "species.h"
+
+class Animal;
+
+enum class AnimalStat : uint8_t {
+  HEALTH,
+  HUNGER,
+  HAPPINESS,
+  ENERGY,
+};
+
+inline constexpr size_t ANIMAL_STAT_COUNT = 4;
+
+// per-animal conditions counted by one sweep over the stat columns
+struct StatCounts {
+  size_t happy = 0;      // happiness above 80
+  size_t neglected = 0;  // Animal::needsAttention
+};
+
+// animals past the thresholds missions watch, kept up to date on every stat write
+struct ThresholdCounts {
+  size_t sick = 0;       // health below AnimalStore::SICK_HEALTH
+  size_t neglected = 0;  // Animal::needsAttention
+  size_t happy = 0;      // happiness above 80
+};
+
+// Owns the animals of a zoo and keeps their stats in structure-of-arrays columns. Animals in a
+// store keep only their slot and read/write their stats through it, so the nightly update is
+// a linear sweep over packed columns instead of a virtual call per heap-allocated animal.
+// Animals are addressed by generational AnimalIds; removal swaps the last slot into the hole.
+class AnimalStore {
+ public:
+  AnimalStore() = default;
+  ~AnimalStore();
+
+  // animals hold a pointer back to their store
+  AnimalStore(const AnimalStore&) = delete;
+  AnimalStore& operator=(const AnimalStore&) = delete;
+
+  // moves the animal's stats into the columns, the animal becomes a handle over its slot
+  AnimalId insert(std::unique_ptr<Animal> animal);
+  // copies the stats back into the animal and hands ownership back to the caller
+  std::unique_ptr<Animal> remove(AnimalId id);
+
+  Animal* find(AnimalId id) const;
+  bool contains(const Animal& animal) const;
+  Animal* at(size_t slot) const;
+  size_t size() const;
+  std::span<const std::unique_ptr<Animal>> animals() const;
+
+  int get(size_t slot, AnimalStat stat) const;
+  void set(size_t slot, AnimalStat stat, int value);
+
+  // running sum of a stat over every animal in the store
+  int64_t total(AnimalStat stat) const;
+
+  // marks the current stats, and whether any stat has changed since the mark
+  void markStats();
+  bool statsChangedSinceMark() const;
+
+  // fused sweep over the health, hunger, happiness and energy columns, chunked like
+  // updateEndOfDay; lazy mode answers from the threshold counts instead
+  StatCounts countStats(size_t workers = 1) const;
+
+  // bumped by every change to the stored animals or their stats
+  uint64_t version() const;
+
+  // number of live animals of a species, and the set of species with at least one
+  size_t speciesCount(Species species) const;
+  SpeciesMask speciesMask() const;
+
+  // exhibit column, a null id means the animal is homeless. The habitat is the exhibit's, and
+  // is what lazy decay judges the placement by.
+  ExhibitId getLocation(const Animal& animal) const;
+  void setLocation(const Animal& animal, ExhibitId exhibit, Habitat habitat = Habitat::UNKNOWN);
+
+  // animals per placement, kept up to date by insert, remove and setLocation
+  size_t placementCount(Placement placement) const;
+  ThresholdCounts thresholdCounts() const;
+
+  // Lazy decay: updateEndOfDay only counts the night, and each animal's stats catch up on the
+  // nights it missed when they're next read or written. Each night, the animals written since
+  // the last one replay their coming nights once, booking the changes to the totals and counts
+  // per night and the night they die on, so the running sums stay current and deadAnimals pops
+  // a queue instead of scanning. Stats read the same as in eager mode at every point.
+  void setLazyDecay(bool lazy);
+  bool isLazyDecay() const;
+
+  // Nightly decay, neglect penalties, habitat adjustment and sleep for every slot, exhibit
+  // habitats are indexed by ExhibitId::index. Runs on the widest kernel the CPU supports, split
+  // into fixed SWEEP_CHUNK slot ranges over up to `workers` threads of the shared ThreadPool;
+  // chunk results are reduced in chunk order so the outcome never depends on the worker count.
+  void updateEndOfDay(const std::vector<Habitat>& exhibit_habitats, size_t workers = 1);
+
+  // where stored animals report their events, the console sink by default
+  EventSink& eventSink() const;
+  void setEventSink(EventSink& sink);
+
+  // ids of animals whose health has reached zero, in slot order
+  std::vector<AnimalId> deadAnimals(size_t workers = 1) const;
+
+  static constexpr size_t SWEEP_CHUNK = 16384;
+
+  static constexpr int SICK_HEALTH = 50;
+
+  // bit flags for the thresholds a set of stats is past
+  static constexpr uint8_t NEGLECTED = 1;
+  static constexpr uint8_t HAPPY = 2;
+  static constexpr uint8_t SICK = 4;
+  static uint8_t thresholdFlags(int health, int hunger, int happiness, int energy);
+
+  // how many nights ahead lazy decay books an animal before looking again, short so taking a
+  // touched animal's booking back out stays about as cheap as the eager night
+  static constexpr uint32_t PLAN_HORIZON = 4;
+
+ private:
+  // the night an animal dies on, or is due a recheck; stale once the slot's stamp moves on
+  struct DeathEntry {
+    uint32_t night;
+    AnimalId id;
+    uint32_t stamp;
+
+    bool operator>(const DeathEntry& other) const {
+      return night > other.night;
+    }
+  };
+
+  // running totals and threshold counts, or one night's change to them, signed so a change can
+  // take animals back out of a count
+  struct Tally {
+    std::array<int64_t, ANIMAL_STAT_COUNT> totals{};
+    int64_t neglected = 0;
+    int64_t happy = 0;
+    int64_t sick = 0;
+    int64_t changes = 0;  // slots whose stats changed
+
+    void add(const Tally& other);
+  };
+
+  // the thresholds a slot is past, and adding them to a tally
+  uint8_t thresholdsAt(size_t slot) const;
+  static void countThresholds(Tally& tally, uint8_t flags, int64_t sign);
+
+  void settle(size_t slot) const;
+  void settleAll() const;
+  // Replays up to `nights` of a settled slot's coming nights, adding each night's change times
+  // sign into drift_. Returns the nights replayed before a fixed point, `death` is the first
+  // one the animal is dead on or NO_DEATH.
+  uint32_t replay(size_t slot, uint32_t nights, int64_t sign, uint32_t& death) const;
+  static constexpr uint32_t NO_DEATH = UINT32_MAX;
+  // book a settled slot's coming nights and queue its death and recheck, and take the booking
+  // back out before its trajectory changes
+  void plan(size_t slot) const;
+  void unplan(size_t slot) const;
+  // settle a slot about to be written and take its booking out until planTouched
+  void touch(size_t slot) const;
+  void planTouched() const;
+  static constexpr uint32_t UNBOOKED = UINT32_MAX;
+  Placement placementFor(size_t slot, ExhibitId exhibit, Habitat habitat) const;
+
+  std::array<size_t, SPECIES_COUNT> species_counts_{};
+  Tally tally_;
+  std::array<size_t, PLACEMENT_COUNT> placement_counts_{};
+  uint64_t version_ = 0;
+  EventSink* sink_ = &consoleEventSink();
+  SlotIndex<AnimalTag> ids_;
+
+  // columns, all indexed by slot
+  mutable std::array<std::vector<int>, ANIMAL_STAT_COUNT> stats_;
+  std::vector<Species> species_;
+  std::vector<ExhibitId> exhibit_;
+  std::vector<Placement> home_;  // placement per setLocation, what lazy decay replays
+  std::vector<std::unique_ptr<Animal>> animals_;
+
+  // lazy decay state, settled_, booked_ and stamp_ are indexed by slot too
+  bool lazy_ = false;
+  uint32_t night_ = 0;
+  mutable std::vector<uint32_t> settled_;  // the night each slot's stats are current to
+  mutable std::vector<uint32_t> booked_;   // the last night of the slot's booked changes
+  mutable std::vector<uint32_t> stamp_;    // bumped whenever a slot's trajectory changes
+  mutable std::vector<Tally> drift_;       // ring of booked changes, indexed by night
+  mutable std::priority_queue<DeathEntry, std::vector<DeathEntry>, std::greater<>> deaths_;
+  mutable std::priority_queue<DeathEntry, std::vector<DeathEntry>, std::greater<>> rechecks_;
+  mutable std::vector<AnimalId> unplanned_;  // touched since the last night, booked at the next
+  int64_t marked_changes_ = 0;
+  std::vector<int> marked_stats_;  // eager mode compares the columns against the mark
+
+  // scratch for updateEndOfDay, kept to avoid reallocating every night
+  std::vector<Placement> placement_;
+  std::vector<Tally> chunk_tallies_;
+};
+
+#endif  // ANIMAL_STORE_H
@@ -6,9 +6,6 @@
 class Bear : public Animal {
  public:
   Bear(std::string name, int age);
-  void makeSound() const override;
-  void updateStatsEndOfDay() override;
-  std::string getPreferredHabitat() const override;
 };
 
 #endif  // BEAR_H
\ No newline at end of file
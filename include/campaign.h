@@ -0,0 +1,66 @@
+#ifndef CAMPAIGN_H
+#define CAMPAIGN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mission.h"
+#include "predicate.h"
+
+// one mission as a campaign describes it, made into a Mission when its day starts
+struct MissionSpec {
+  static constexpr size_t NO_PREDICATE = SIZE_MAX;
+
+  std::string description;
+  MissionType type = MissionType::OWN_X_ANIMALS;
+  bool required = true;
+  bool end_of_day = false;
+  int int_param = 0;
+  double float_param = 0.0;
+  bool all_animals = false;  // int_param is the zoo's animal count when the day starts
+  int reward = 0;
+  size_t predicate = NO_PREDICATE;  // the campaign's own condition, see Campaign::predicateFor
+};
+
+// Days of missions, loaded from text such as
+//
+//   day 1
+//   required "Purchase your first animal" own_x_animals 1
+//   optional "End day with balance of $1200+" balance_at_least 1200 reward 100 end_of_day
+//
+// A mission line names a MissionType in lower case, then its parameter if the type takes one
+// ("all" stands for the number of animals when the day starts). "reward <n>" and "end_of_day"
+// may follow, and last "when <condition>" replaces the type's check with a condition for
+// compilePredicate; the type still decides how progress is shown. Days are numbered from 1 in
+// order, and '#' starts a comment. Conditions are compiled while loading, so checking a mission
+// never parses anything.
+class Campaign {
+ public:
+  // on failure the campaign is left empty and error names the line at fault
+  bool load(std::string_view text, std::string& error);
+  bool loadFile(const std::string& path, std::string& error);
+
+  int getDayCount() const;
+  // empty for a day outside the campaign
+  std::span<const MissionSpec> missionsFor(int day) const;
+  // null when the spec uses its type's default check
+  const PredicateProgram* predicateFor(const MissionSpec& spec) const;
+
+ private:
+  bool parseLine(std::span<const std::string_view> tokens, std::string& error);
+
+  std::vector<MissionSpec> missions_;
+  std::vector<size_t> day_starts_;  // index into missions_ where each day begins
+  std::vector<PredicateProgram> predicates_;
+};
+
+// the built-in ten day campaign
+const Campaign& standardCampaign();
+
+std::string_view missionTypeName(MissionType type);
+
+#endif  // CAMPAIGN_H
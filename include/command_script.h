@@ -0,0 +1,67 @@
+#ifndef COMMAND_SCRIPT_H
+#define COMMAND_SCRIPT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "species.h"
+
+// commands understood by Game::runScript, NONE is a blank or comment-only line
+enum class ScriptVerb : uint8_t {
+  NONE,
+  BUY,       // buy <species> <animal>
+  BUILD,     // build <habitat> <exhibit>
+  SELL,      // sell <animal>
+  DEMOLISH,  // demolish <exhibit>
+  PLACE,     // place <animal> <exhibit>, moving the animal if it is already housed
+  REMOVE,    // remove <animal>
+  FEED,      // feed <animal>
+  PLAY,      // play <animal>
+  EXERCISE,  // exercise <animal>
+  TREAT,     // treat <animal>
+  CLEAN,     // clean <exhibit>
+  MISSIONS,  // missions
+  END,       // end
+  QUIT,      // quit
+  INVALID,
+};
+
+inline constexpr size_t SCRIPT_MAX_ARGS = 2;
+
+// one parsed script line, the arguments point into the line it was parsed from
+struct ScriptCommand {
+  ScriptVerb verb = ScriptVerb::NONE;
+  std::array<std::string_view, SCRIPT_MAX_ARGS> args{};
+  size_t arg_count = 0;
+};
+
+// Splits a line into whitespace separated tokens without copying. A token wrapped in double
+// quotes may contain spaces, and an unquoted '#' starts a comment that runs to the end of line.
+class ScriptTokenizer {
+ public:
+  explicit ScriptTokenizer(std::string_view line);
+
+  // false once the line (or the part before a comment) is used up
+  bool next(std::string_view& token);
+
+ private:
+  std::string_view rest_;
+};
+
+// takes the next line off the front of script, false when nothing is left
+bool nextScriptLine(std::string_view& script, std::string_view& line);
+
+// INVALID for an unknown verb or the wrong number of arguments
+ScriptCommand parseScriptCommand(std::string_view line);
+
+std::string_view scriptVerbName(ScriptVerb verb);
+
+// species and habitat words are matched ignoring case, so "lion" and "Lion" both work
+bool scriptWordEquals(std::string_view a, std::string_view b);
+std::optional<Species> speciesFromScript(std::string_view word);
+Habitat habitatFromScript(std::string_view word);
+
+#endif  // COMMAND_SCRIPT_H
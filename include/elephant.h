@@ -6,9 +6,6 @@
 class Elephant : public Animal {
  public:
   Elephant(std::string name, int age);
-  void makeSound() const override;
-  void updateStatsEndOfDay() override;
-  std::string getPreferredHabitat() const override;
 };
 
 #endif  // ELEPHANT_H
@@ -0,0 +1,95 @@
+#ifndef EVENT_SINK_H
+#define EVENT_SINK_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+
+// everything the simulation reports while it runs
+enum class EventType : uint8_t {
+  // animals
+  FOOD_REFUSED,
+  ANIMAL_ATE,
+
+  // exhibits
+  NULL_ANIMAL,
+  ALREADY_IN_THIS_EXHIBIT,
+  EXHIBIT_AT_CAPACITY,
+  ANIMAL_ADDED,
+  NOT_IN_THIS_EXHIBIT,
+  ANIMAL_REMOVED,
+  EXHIBIT_CLEANED,
+
+  // zoo
+  ANIMAL_UNAFFORDABLE,
+  ANIMAL_PURCHASED,
+  SOLD_ANIMAL_NOT_IN_ZOO,
+  ANIMAL_SOLD,
+  EXHIBIT_UNAFFORDABLE,
+  EXHIBIT_PURCHASED,
+  EXHIBIT_NOT_IN_ZOO,
+  EXHIBIT_SOLD,
+  ANIMAL_NOT_IN_ZOO,
+  ALREADY_IN_EXHIBIT,
+  PLACEMENT_FAILED,
+  MOVED_ANIMAL_HOMELESS,
+  MOVE_TARGET_FULL,
+  ANIMAL_MOVED,
+  ANIMAL_DIED,
+
+  // player
+  ANIMAL_MISSING,
+  ANIMAL_NOT_ALIVE,
+  FEEDING_UNAFFORDABLE,
+  ANIMAL_FED,
+  TOO_TIRED_TO_PLAY,
+  ANIMAL_PLAYED,
+  TOO_TIRED_TO_EXERCISE,
+  ANIMAL_EXERCISED,
+  TREATMENT_UNAFFORDABLE,
+  ANIMAL_TREATED,
+  EXHIBIT_MISSING,
+  PLAYER_CLEANED_EXHIBIT,
+
+  // missions
+  MISSION_COMPLETED,
+};
+
+// Fields an event does not use are left empty. The views point into the emitting objects and
+// are only valid for the duration of EventSink::emit.
+struct ZooEvent {
+  EventType type;
+  std::string_view actor{};    // player name
+  std::string_view subject{};  // animal name, or mission description
+  std::string_view species{};
+  std::string_view place{};    // exhibit name
+  double amount = 0.0;         // money involved
+};
+
+// Receives events from Zoo, Exhibit, Animal, Player and MissionSystem instead of having them
+// write to std::cout, so headless runs skip formatting and I/O entirely.
+class EventSink {
+ public:
+  virtual ~EventSink() = default;
+  virtual void emit(const ZooEvent& event) = 0;
+};
+
+class NullEventSink : public EventSink {
+ public:
+  void emit(const ZooEvent&) override {}
+};
+
+// formats each event as the game's console text
+class ConsoleEventSink : public EventSink {
+ public:
+  explicit ConsoleEventSink(std::ostream& out);
+  void emit(const ZooEvent& event) override;
+
+ private:
+  std::ostream& out_;
+};
+
+// shared console sink writing to std::cout, the default for every emitter
+EventSink& consoleEventSink();
+
+#endif  // EVENT_SINK_H
@@ -1,16 +1,47 @@
 #ifndef EXHIBIT_H
 #define EXHIBIT_H
 
+#include <array>
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "animal.h"
+#include "event_sink.h"
+#include "handles.h"
+#include "object_pool.h"
+#include "species.h"
+
+// running totals a zoo keeps over the exhibits it owns
+struct ExhibitTotals {
+  int64_t cleanliness = 0;
+  size_t dirty = 0;      // exhibits that need cleaning
+  uint64_t version = 0;  // bumped on every cleanliness change
+
+  // exhibits at each cleanliness level, so threshold checks don't visit the exhibits
+  static constexpr int MAX_CLEANLINESS = 100;
+  std::array<uint32_t, MAX_CLEANLINESS + 1> by_cleanliness{};
+
+  // MAX_CLEANLINESS when there are no exhibits
+  int minCleanliness() const {
+    int level = 0;
+    while (level < MAX_CLEANLINESS && by_cleanliness[level] == 0) {
+      ++level;
+    }
+    return level;
+  }
+};
 
 class Exhibit {
  public:
   Exhibit(std::string name, std::string type, int capacity, double purchase_cost,
           double maintenance_cost);
 
+  // exhibits are allocated from size-class pools, see object_pool.h
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size) noexcept;
+
   // animal management
   bool canAddAnimal() const;
   bool addAnimal(Animal* animal);
@@ -18,25 +49,39 @@ class Exhibit {
   void removeAllAnimalsFromExhibit();
   bool containsAnimal(Animal* animal) const;
   std::vector<Animal*> getAllAnimals();
+  std::span<Animal* const> animalView() const;
 
   // getters
+  ExhibitId getId() const;
   const std::string& getName() const;
   const std::string& getType() const;
+  Habitat getHabitat() const;
   int getMaxCapacity() const;
   size_t getCapacityUsed() const;
   int getCleanliness() const;
   double getPurchaseCost() const;
   double getMaintenanceCost() const;
-  bool needsCleaning();
+  bool needsCleaning() const;
 
   // setters
   void updateCleanliness(int delta);
   void clean();
   void setName(const std::string& name);
 
+  // cleaning is refused above this
+  static constexpr int CLEANABLE_AT_MOST = 70;
+
  private:
+  friend class Zoo;
+
+  void setCleanliness(int cleanliness);
+
+  ExhibitId id_;                     // assigned by the owning zoo
+  ExhibitTotals* totals_ = nullptr;        // owning zoo's totals
+  EventSink* sink_ = &consoleEventSink();  // owning zoo's sink
   std::string name_;
   std::string type_;
+  Habitat habitat_;  // parsed from type_
   int capacity_;
   int cleanliness_;
   double purchase_cost_;
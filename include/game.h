@@ -1,24 +1,76 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <iostream>
+#include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "MissionSystem.h"
 #include "player.h"
+#include "rng.h"
+#include "screen_buffer.h"
 #include "zoo.h"
 
+// how a game ended, PLAYING while it hasn't
+enum class GameOutcome : uint8_t {
+  PLAYING,
+  COMPLETED,       // survived all ten days and got a final score
+  MISSION_FAILED,  // a required mission could no longer be met
+  BANKRUPT,
+  NO_ANIMALS,
+  QUIT,
+};
+
+struct GameResult {
+  GameOutcome outcome = GameOutcome::PLAYING;
+  int score = 0;  // the final score out of 10, only set for COMPLETED games
+  int missions_offered = 0;
+  int missions_completed = 0;
+};
+
 class Game {
  public:
-  Game(const Player& player, std::string zoo_name);
+  // A game replays exactly when given the same seed and the same input. Everything it prints
+  // goes to out, so a game can run silently or alongside others.
+  Game(const Player& player, std::string zoo_name, uint64_t seed = randomSeed(),
+       std::ostream& out = std::cout);
   void start();
 
+  // Plays the game from a command script instead of the menus, one command per line (see
+  // command_script.h). Stops at the end of the script or when the game ends, and returns false
+  // if any line could not be parsed or named an animal or exhibit the zoo doesn't have.
+  bool runScript(std::istream& script);
+
+  // runs one script line, false if it could not be parsed or named something the zoo lacks
+  bool runCommand(std::string_view line);
+
+  // where the zoo and the player report events
+  void setEventSink(EventSink& sink);
+
+  // plays the campaign's missions instead of the standard ones, call before the first day's
+  // actions; the campaign must outlive the game
+  void setCampaign(const Campaign& campaign);
+
+  const Zoo& getZoo() const;
+  const std::vector<Mission>& getMissions() const;
+  const GameResult& getResult() const;
+  uint64_t getSeed() const;
+  bool isRunning() const;
+  int getActionPoints() const;
+  int getMaxActionPoints() const;
+
  private:
   Player player_;
   Zoo zoo_;
+  std::ostream& out_;
+  ScreenBuffer screen_;  // menus and listings are built here and written in one flush
   MissionSystem mission_system_;
   bool running_;
+  uint64_t seed_;
+  GameResult result_;
 
   int action_points_;
   int max_action_points_;
@@ -52,6 +104,18 @@ class Game {
   void removeAnimalFromExhibit();
   void moveAnimalToExhibit();
 
+  // the actions themselves, shared by the menus and the command script
+  std::unique_ptr<Animal> makeAnimal(Species species, const std::string& name);
+  void buyAnimal(std::unique_ptr<Animal> animal);
+  void sellAnimal(Animal* animal);
+  void feedAnimal(Animal* animal);
+  void playWithAnimal(Animal* animal);
+  void exerciseAnimal(Animal* animal);
+  void treatAnimal(Animal* animal);
+  void addAnimalToExhibit(Animal* animal, Exhibit* exhibit);
+  void removeAnimalFromExhibit(Animal* animal);
+  void moveAnimalToExhibit(Animal* animal, Exhibit* exhibit);
+
   // exhibit actions
   Exhibit* chooseExhibit();
   void displayAllExhibits();
@@ -61,6 +125,11 @@ class Game {
   void sellExhibit();
   void cleanExhibit();
 
+  std::unique_ptr<Exhibit> makeExhibit(Habitat habitat, const std::string& name);
+  void buyExhibit(std::unique_ptr<Exhibit> exhibit);
+  void sellExhibit(Exhibit* exhibit);
+  void cleanExhibit(Exhibit* exhibit);
+
   // zoo actions
   void checkBalance();
   void viewZooRating();
@@ -68,12 +137,19 @@ class Game {
   // action tracking
   bool useActionPoint(const std::string action_description);
   void resetActionPoints();
-  int getActionPoints() const;
-  int getMaxActionPoints() const;
   void updateMaxActionPoints();
 
+  // script lookups go by name, the first match wins
+  Animal* findAnimalByName(std::string_view name) const;
+  Exhibit* findExhibitByName(std::string_view name) const;
+
+  bool runCommand(std::string_view line, size_t line_number);
+
+  void displayWelcome();
   void endDay();
+  void finishGame(GameOutcome outcome);
   void exitGame();
+  void leaveGame();
   void displayHelp();
 
   void handleGameCompletion();
@@ -0,0 +1,15 @@
+#ifndef HANDLES_H
+#define HANDLES_H
+
+#include "slot_map.h"
+
+struct AnimalTag;
+struct ExhibitTag;
+
+// stable ids for animals and exhibits owned by a zoo, safe to hold across sales and deaths
+using AnimalId = Handle<AnimalTag>;
+using ExhibitId = Handle<ExhibitTag>;
+using AnimalIdSet = HandleSet<AnimalTag>;
+using ExhibitIdSet = HandleSet<ExhibitTag>;
+
+#endif  // HANDLES_H
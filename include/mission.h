@@ -1,3 +1,7 @@
+#ifndef MISSION_H
+#define MISSION_H
+
+#include <cstddef>
 #include <string>
 
 enum class MissionType {
@@ -22,6 +26,10 @@ enum class MissionType {
   OWN_SPECIAL_ANIMAL,
 };
 
+inline constexpr size_t MISSION_TYPE_COUNT = 19;
+
+struct PredicateProgram;
+
 struct Mission {
   std::string description;
   MissionType type;
@@ -37,6 +45,9 @@ struct Mission {
 
   int reward_amount;
 
+  // the campaign's condition for this mission, defaultPredicate(type) when null
+  const PredicateProgram* predicate = nullptr;
+
   Mission(bool required, const std::string& description, MissionType type, int int_param = 0,
           double float_param = 0.0, double reward_amount = 0.0, bool end_of_day = false)
       : description(description),
@@ -49,3 +60,5 @@ struct Mission {
         float_param(float_param),
         reward_amount(reward_amount) {}
 };
+
+#endif  // MISSION_H
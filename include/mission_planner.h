@@ -0,0 +1,66 @@
+#ifndef MISSION_PLANNER_H
+#define MISSION_PLANNER_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "MissionSystem.h"
+#include "handles.h"
+#include "mission.h"
+#include "zoo.h"
+
+// the care a player spends an action point on, see Player
+enum class Care : uint8_t {
+  FEED,
+  PLAY,
+  EXERCISE,
+  TREAT,
+};
+
+inline constexpr size_t CARE_COUNT = 4;
+
+// what one care action does to an animal's stats, refused while energy is below min_energy
+struct CareEffect {
+  int health;
+  int hunger;
+  int happiness;
+  int energy;
+  int min_energy;
+};
+
+// indexed by Care, mirrors Player::feedAnimal, playWithAnimal, exerciseAnimal and treatAnimal
+inline constexpr std::array<CareEffect, CARE_COUNT> CARE_EFFECTS = {{
+    {0, -20, 5, 5, 0},      // feed, costs the species' feeding cost
+    {0, 5, 15, -10, 20},    // play
+    {10, 10, 10, -20, 30},  // exercise
+    {30, 0, 0, 10, 0},      // treat, costs TREATMENT_COST
+}};
+
+inline constexpr double TREATMENT_COST = 50.0;
+
+// what today's tracking has recorded so far
+struct DayProgress {
+  const AnimalIdSet& fed;
+  const ExhibitIdSet& cleaned;
+  bool played = false;
+  bool exercised = false;
+};
+
+// Whether every required mission still open can be met before the day ends with the action
+// points left and the zoo's balance. Purchases and sales cost money and no actions; care and
+// cleaning cost an action each. Each animal's useful care sequences are found by a short search
+// over its stats, then combined by a table memoized over (actions spent, animals fed, played,
+// exercised) holding the least money that state needs. Purchases are searched on top of that
+// table for each way of selling exhibits, with animals moved freely between exhibits and new
+// exhibits bought at their largest capacity. When that finds no plan, the search runs again with
+// every exhibit and animal also up for sale at half its purchase cost, animals after any of their
+// care, and with enough purchases to replace what's sold. That search only cuts corners in the
+// zoo's favor, so a false answer means the missions can't be met; zoos too large for its bounds
+// get true. Missions the plan can't model (money, rating and visitor targets, campaign
+// conditions) are taken as achievable.
+bool requiredMissionsFeasible(const Zoo& zoo, const MissionContext& context,
+                              std::span<const Mission> missions, const DayProgress& progress,
+                              int action_points);
+
+#endif  // MISSION_PLANNER_H
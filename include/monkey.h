@@ -8,9 +8,6 @@
 class Monkey : public Animal {
  public:
   Monkey(std::string name, int age);
-  void makeSound() const override;
-  void updateStatsEndOfDay() override;
-  std::string getPreferredHabitat() const override;
 };
 
 #endif  // MONKEY_H
@@ -0,0 +1,49 @@
+#ifndef NIGHTLY_KERNEL_H
+#define NIGHTLY_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "species.h"
+
+// stat bounds the kernel clamps to, checked against Animal's in animal_store.cpp
+inline constexpr int KERNEL_MIN_STAT = 0;
+inline constexpr int KERNEL_MAX_STAT = 100;
+
+// where an animal spends the night, resolved from its exhibit before the sweep
+enum class Placement : uint8_t {
+  HOMELESS,
+  PREFERRED_HABITAT,
+  OTHER_HABITAT,
+};
+
+inline constexpr size_t PLACEMENT_COUNT = 3;
+
+// packed per-slot columns the nightly update reads and writes
+struct NightlyLanes {
+  int* health;
+  int* hunger;
+  int* happiness;
+  int* energy;
+  const Species* species;
+  const Placement* placement;
+  size_t count;
+};
+
+enum class KernelIsa : uint8_t {
+  SCALAR,
+  SSE41,
+  AVX2,
+};
+
+// widest instruction set the running CPU supports
+KernelIsa detectKernelIsa();
+bool kernelIsaSupported(KernelIsa isa);
+const char* kernelIsaName(KernelIsa isa);
+
+// Nightly decay, neglect penalties, habitat adjustment and sleep for every lane. The vector
+// paths replicate the scalar per-step clamps exactly, so every ISA produces identical stats.
+void runNightlyKernel(const NightlyLanes& lanes);
+void runNightlyKernel(const NightlyLanes& lanes, KernelIsa isa);
+
+#endif  // NIGHTLY_KERNEL_H
@@ -0,0 +1,24 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Size-class pools backing Animal and Exhibit allocations. Freed objects go on a per-thread
+// free list for their size class and are handed out again by the next allocation of that
+// class, so creating and destroying game objects in a steady state never reaches the system
+// allocator. Chunks are kept for the lifetime of the process.
+
+struct PoolStats {
+  uint64_t chunk_allocations = 0;  // chunks requested from the system allocator
+  uint64_t allocations = 0;        // objects handed out
+  uint64_t deallocations = 0;      // objects returned
+};
+
+void* poolAllocate(size_t size);
+void poolDeallocate(void* ptr, size_t size) noexcept;
+
+// counters for the calling thread
+PoolStats poolStats();
+
+#endif  // OBJECT_POOL_H
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "animal.h"
+#include "event_sink.h"
 #include "exhibit.h"
 #include "zoo.h"
 
@@ -13,6 +14,10 @@ class Player {
 
   const std::string& getName() const;
 
+  // where the player's actions are reported, the console sink by default
+  EventSink& getEventSink() const;
+  void setEventSink(EventSink& sink);
+
   bool validateAnimal(Animal* animal);
 
   bool feedAnimal(Zoo& zoo, Animal* animal);
@@ -24,6 +29,7 @@ class Player {
 
  private:
   std::string name_;
+  EventSink* sink_ = &consoleEventSink();
 };
 
 #endif  // PLAYER_H
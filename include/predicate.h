@@ -0,0 +1,89 @@
+#ifndef PREDICATE_H
+#define PREDICATE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mission.h"
+
+// zoo figures a mission predicate can read, filled once per check by MissionSystem
+enum class MissionVar : uint8_t {
+  ANIMALS,
+  EXHIBITS,
+  SPECIES,  // number of species owned
+  HOMELESS,
+  MISPLACED,
+  SICK,
+  NEEDY,
+  MIN_CLEANLINESS,
+  DIRTY,
+  BALANCE,
+  FED,
+  CLEANED,
+  PLAYED,
+  EXERCISED,
+  SPECIES_MASK,  // read by OWNS, not by name
+  // from the zoo's metrics, only filled when a predicate reads them
+  PROJECTED_BALANCE,
+  RATING,
+  VISITORS,
+};
+
+inline constexpr size_t MISSION_VAR_COUNT = 18;
+
+using MissionVars = std::array<double, MISSION_VAR_COUNT>;
+
+enum class PredicateOp : uint8_t {
+  LOAD,         // push vars[var]
+  CONST,        // push value
+  INT_PARAM,    // push the mission's int_param
+  FLOAT_PARAM,  // push the mission's float_param
+  OWNS,         // push whether the species mask shares a bit with value
+  LT,
+  LE,
+  GT,
+  GE,
+  EQ,
+  NE,
+  AND,
+  OR,
+  NOT,
+};
+
+struct PredicateInstr {
+  PredicateOp op;
+  MissionVar var = MissionVar::ANIMALS;
+  double value = 0.0;
+};
+
+inline constexpr size_t PREDICATE_MAX_STACK = 8;
+
+// A mission condition compiled to postfix code over a fixed-size stack. Compiled once when a
+// campaign is loaded, evaluating it never parses or allocates.
+struct PredicateProgram {
+  std::vector<PredicateInstr> code;
+  bool reads_metrics = false;
+
+  bool evaluate(const MissionVars& vars, const Mission& mission) const;
+};
+
+// Compiles a condition such as "homeless == 0 and species >= param". Operands are numbers,
+// the variable names listed by missionVarName, "param" (the mission's int_param) and "amount"
+// (its float_param); a lone operand is true when non-zero. "owns <species>" tests for a
+// species, "not", "and" and "or" combine tests in that order of precedence. False with a
+// message in error when the expression is malformed.
+bool compilePredicate(std::span<const std::string_view> tokens, PredicateProgram& program,
+                      std::string& error);
+bool compilePredicate(std::string_view expression, PredicateProgram& program, std::string& error);
+
+std::string_view missionVarName(MissionVar var);
+
+// the condition each mission type is checked by unless a campaign gives its own
+const PredicateProgram& defaultPredicate(MissionType type);
+
+#endif  // PREDICATE_H
@@ -8,9 +8,6 @@
 class Rabbit : public Animal {
  public:
   Rabbit(std::string name, int age);
-  void makeSound() const override;
-  void updateStatsEndOfDay() override;
-  std::string getPreferredHabitat() const override;
 };
 
 #endif  // RABBIT_H
\ No newline at end of file
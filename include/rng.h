@@ -0,0 +1,54 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+// xoshiro256** generator: 32 bytes of state, a few cycles per draw, and the same sequence for
+// the same seed on every platform. Works with <random> distributions, but rollBetween is
+// preferred since the standard distributions are implementation defined.
+class Rng {
+ public:
+  using result_type = uint64_t;
+
+  explicit Rng(uint64_t seed);
+
+  uint64_t getSeed() const;
+  void reseed(uint64_t seed);
+
+  static constexpr result_type min() {
+    return 0;
+  }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+    const uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+    return result;
+  }
+
+  // uniform in [min, max], both inclusive
+  int rollBetween(int min, int max);
+
+ private:
+  static constexpr uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  uint64_t seed_;
+  std::array<uint64_t, 4> state_;
+};
+
+// a fresh seed from std::random_device, for games that weren't given one
+uint64_t randomSeed();
+
+#endif  // RNG_H
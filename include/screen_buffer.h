@@ -0,0 +1,45 @@
+#ifndef SCREEN_BUFFER_H
+#define SCREEN_BUFFER_H
+
+#include <charconv>
+#include <concepts>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+// a double written with a fixed number of decimals, like std::fixed << std::setprecision
+struct Fixed {
+  double value;
+  int precision;
+};
+
+// Builds a whole screen in one reusable buffer and writes it with a single call, instead of
+// a stream insertion (and with synced stdio, a write) per fragment. Numbers are formatted with
+// std::to_chars, so no stream formatting state is read or left behind.
+class ScreenBuffer {
+ public:
+  explicit ScreenBuffer(std::ostream& out);
+
+  ScreenBuffer& operator<<(std::string_view text);
+  ScreenBuffer& operator<<(char c);
+  ScreenBuffer& operator<<(Fixed number);
+
+  template <std::integral T>
+    requires(!std::same_as<T, bool> && !std::same_as<T, char>)
+  ScreenBuffer& operator<<(T value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer_.append(digits, result.ptr);
+    return *this;
+  }
+
+  // writes the screen and empties the buffer, keeping its capacity for the next one
+  void flush();
+  std::string_view view() const;
+
+ private:
+  std::ostream& out_;
+  std::string buffer_;
+};
+
+#endif  // SCREEN_BUFFER_H
@@ -0,0 +1,75 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "campaign.h"
+#include "game.h"
+#include "rng.h"
+
+// Plays a simulated player's turns. A strategy drives the game only through
+// Game::runCommand, so it's held to the same rules as a script or a person. The runner ends
+// each day after playDay returns. Strategies are shared by every game in a run, so playDay
+// must not change the strategy itself.
+class Strategy {
+ public:
+  virtual ~Strategy() = default;
+  virtual std::string_view getName() const = 0;
+  virtual void playDay(Game& game, Rng& rng) const = 0;
+};
+
+// works toward the day's missions: buys missing species, houses animals in their preferred
+// habitats, then spends the remaining action points on feeding, cleaning and treatment
+class MissionStrategy : public Strategy {
+ public:
+  std::string_view getName() const override;
+  void playDay(Game& game, Rng& rng) const override;
+};
+
+// a baseline that issues random commands
+class RandomStrategy : public Strategy {
+ public:
+  std::string_view getName() const override;
+  void playDay(Game& game, Rng& rng) const override;
+};
+
+// nullptr for an unknown name
+std::unique_ptr<Strategy> makeStrategy(std::string_view name);
+
+inline constexpr int MAX_FINAL_SCORE = 10;
+inline constexpr size_t GAME_OUTCOME_COUNT = 6;
+
+// a game that stops advancing for this many tries in a row is given up on as stalled
+inline constexpr int MAX_STALLED_DAYS = 3;
+
+struct SimulationReport {
+  size_t games = 0;
+  // indexed by GameOutcome, PLAYING counts games the runner gave up on as stalled
+  std::array<size_t, GAME_OUTCOME_COUNT> outcomes{};
+  // completed games by final score
+  std::array<size_t, MAX_FINAL_SCORE + 1> scores{};
+  uint64_t missions_offered = 0;
+  uint64_t missions_completed = 0;
+  uint64_t days_played = 0;
+
+  void add(const SimulationReport& other);
+  double meanScore() const;
+};
+
+// plays one silent game with the given seed, the same seed always gives the same report
+SimulationReport simulateGame(const Strategy& strategy, uint64_t seed,
+                              const Campaign& campaign = standardCampaign());
+
+// Plays games seeded first_seed, first_seed + 1, ... on the shared ThreadPool. Games are split
+// into fixed chunks and reduced in order, so the report doesn't depend on the thread count.
+SimulationReport simulateGames(const Strategy& strategy, size_t games, uint64_t first_seed,
+                               size_t workers, const Campaign& campaign = standardCampaign());
+
+std::string_view gameOutcomeName(GameOutcome outcome);
+
+#endif  // SIMULATION_H
@@ -0,0 +1,276 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Stable handle into a SlotIndex. The generation is bumped every time a slot is freed, so a
+// handle kept after its object was removed no longer resolves instead of pointing at whatever
+// reuses the slot.
+template <typename Tag>
+struct Handle {
+  static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+  uint32_t index = INVALID_INDEX;
+  uint32_t generation = 0;
+
+  bool isNull() const {
+    return index == INVALID_INDEX;
+  }
+
+  friend auto operator<=>(const Handle&, const Handle&) = default;
+};
+
+// Maps stable handles to dense positions. The dense positions stay packed: removing an
+// element moves the last one into the hole, and the owner mirrors that move in its own
+// storage (a vector, or several columns).
+template <typename Tag>
+class SlotIndex {
+ public:
+  using Id = Handle<Tag>;
+
+  // dense positions touched by an erase: the hole and the position that was moved into it
+  struct Erased {
+    size_t hole;
+    size_t last;
+  };
+
+  // registers a new element at dense position size()
+  Id insert() {
+    uint32_t index;
+    if (!free_slots_.empty()) {
+      index = free_slots_.back();
+      free_slots_.pop_back();
+    } else {
+      index = static_cast<uint32_t>(slots_.size());
+      slots_.push_back({0, 0});
+    }
+
+    slots_[index].dense = static_cast<uint32_t>(dense_to_slot_.size());
+    dense_to_slot_.push_back(index);
+    return {index, slots_[index].generation};
+  }
+
+  bool contains(Id id) const {
+    return id.index < slots_.size() && slots_[id.index].generation == id.generation &&
+           slots_[id.index].dense != FREE;
+  }
+
+  size_t denseIndex(Id id) const {
+    return slots_[id.index].dense;
+  }
+
+  Id idAt(size_t dense) const {
+    uint32_t index = dense_to_slot_[dense];
+    return {index, slots_[index].generation};
+  }
+
+  // frees the handle; the caller must move its element at `last` into `hole` and pop back
+  Erased erase(Id id) {
+    size_t hole = slots_[id.index].dense;
+    size_t last = dense_to_slot_.size() - 1;
+
+    uint32_t moved = dense_to_slot_[last];
+    dense_to_slot_[hole] = moved;
+    slots_[moved].dense = static_cast<uint32_t>(hole);
+    dense_to_slot_.pop_back();
+
+    slots_[id.index].dense = FREE;
+    slots_[id.index].generation++;
+    free_slots_.push_back(id.index);
+    return {hole, last};
+  }
+
+  size_t size() const {
+    return dense_to_slot_.size();
+  }
+
+  // upper bound of handle indices, for tables indexed by Id::index
+  size_t capacity() const {
+    return slots_.size();
+  }
+
+ private:
+  static constexpr uint32_t FREE = std::numeric_limits<uint32_t>::max();
+
+  struct Slot {
+    uint32_t dense;
+    uint32_t generation;
+  };
+
+  std::vector<Slot> slots_;
+  std::vector<uint32_t> dense_to_slot_;
+  std::vector<uint32_t> free_slots_;
+};
+
+// Densely stored values addressed through stable generational handles, with O(1) lookup and
+// O(1) swap-and-pop removal.
+template <typename T, typename Tag>
+class SlotMap {
+ public:
+  using Id = Handle<Tag>;
+
+  Id insert(T value) {
+    values_.push_back(std::move(value));
+    return index_.insert();
+  }
+
+  bool contains(Id id) const {
+    return index_.contains(id);
+  }
+
+  T* find(Id id) {
+    return contains(id) ? &values_[index_.denseIndex(id)] : nullptr;
+  }
+
+  const T* find(Id id) const {
+    return contains(id) ? &values_[index_.denseIndex(id)] : nullptr;
+  }
+
+  // removes the value and returns it, the last value takes its dense position
+  T extract(Id id) {
+    auto erased = index_.erase(id);
+    T value = std::move(values_[erased.hole]);
+    if (erased.hole != erased.last) {
+      values_[erased.hole] = std::move(values_[erased.last]);
+    }
+    values_.pop_back();
+    return value;
+  }
+
+  Id idAt(size_t dense) const {
+    return index_.idAt(dense);
+  }
+
+  T& operator[](size_t dense) {
+    return values_[dense];
+  }
+
+  const T& operator[](size_t dense) const {
+    return values_[dense];
+  }
+
+  size_t size() const {
+    return values_.size();
+  }
+
+  size_t capacity() const {
+    return index_.capacity();
+  }
+
+  // dense values, in the same order as idAt
+  std::span<const T> values() const {
+    return values_;
+  }
+
+  bool empty() const {
+    return values_.empty();
+  }
+
+  auto begin() {
+    return values_.begin();
+  }
+
+  auto end() {
+    return values_.end();
+  }
+
+  auto begin() const {
+    return values_.begin();
+  }
+
+  auto end() const {
+    return values_.end();
+  }
+
+ private:
+  std::vector<T> values_;
+  SlotIndex<Tag> index_;
+};
+
+// Set of handles as a dense bitset over handle indices. Each set bit remembers the generation
+// it was added under, so a stale handle is not a member. A newer handle on the same index takes
+// the bit over, and the member it displaces is still counted by size() until clear(), which
+// only touches the words. size() is a popcount.
+template <typename Tag>
+class HandleSet {
+ public:
+  using Id = Handle<Tag>;
+
+  // true when the handle was not already a member; a null handle is never one
+  bool insert(Id id) {
+    if (id.isNull()) {
+      return false;
+    }
+    size_t word = id.index / WORD_BITS;
+    uint64_t bit = uint64_t{1} << (id.index % WORD_BITS);
+    if (word >= words_.size()) {
+      words_.resize(word + 1, 0);
+    }
+    if (id.index >= generations_.size()) {
+      generations_.resize(id.index + 1, 0);
+    }
+    if ((words_[word] & bit) != 0) {
+      if (generations_[id.index] == id.generation) {
+        return false;
+      }
+      ++displaced_;
+    }
+    words_[word] |= bit;
+    generations_[id.index] = id.generation;
+    return true;
+  }
+
+  bool contains(Id id) const {
+    if (id.isNull()) {
+      return false;
+    }
+    size_t word = id.index / WORD_BITS;
+    return word < words_.size() && (words_[word] >> (id.index % WORD_BITS) & 1) != 0 &&
+           generations_[id.index] == id.generation;
+  }
+
+  size_t size() const {
+    size_t count = displaced_;
+    for (uint64_t word : words_) {
+      count += std::popcount(word);
+    }
+    return count;
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  void clear() {
+    std::fill(words_.begin(), words_.end(), 0);
+    displaced_ = 0;
+  }
+
+  // calls fn with every member not displaced, in index order
+  template <typename Fn>
+  void forEach(Fn&& fn) const {
+    for (size_t word = 0; word < words_.size(); ++word) {
+      for (uint64_t bits = words_[word]; bits != 0; bits &= bits - 1) {
+        uint32_t index = static_cast<uint32_t>(word * WORD_BITS + std::countr_zero(bits));
+        fn(Id{index, generations_[index]});
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t WORD_BITS = 64;
+
+  std::vector<uint64_t> words_;
+  std::vector<uint32_t> generations_;  // indexed by handle index, meaningful for set bits
+  size_t displaced_ = 0;               // members whose bit a newer generation took over
+};
+
+#endif  // SLOT_MAP_H
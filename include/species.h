@@ -0,0 +1,114 @@
+#ifndef SPECIES_H
+#define SPECIES_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// compact ids for the species the zoo can own, usable as bit positions in a SpeciesMask
+enum class Species : uint8_t {
+  LION,
+  BEAR,
+  ELEPHANT,
+  MONKEY,
+  PENGUIN,
+  RABBIT,
+  TORTOISE,
+};
+
+inline constexpr size_t SPECIES_COUNT = 7;
+
+// exhibit types, UNKNOWN covers any type name no species prefers
+enum class Habitat : uint8_t {
+  UNKNOWN,
+  GRASSLAND,
+  FOREST,
+  JUNGLE,
+  SAVANNA,
+  ARCTIC,
+};
+
+// per-species stat changes applied every night before sleep
+struct DailyDecay {
+  int hunger;
+  int happiness;
+  int energy;
+};
+
+// everything that sets one species apart from another
+struct SpeciesTraits {
+  std::string_view name;
+  Habitat habitat;
+  double purchase_cost;
+  double feeding_cost;
+  double maintenance_cost;
+  DailyDecay decay;
+  std::string_view sound;  // "<name> the <species> is <sound>!"
+};
+
+// one row per Species, in enum order; adding a species is adding a row here
+inline constexpr std::array<SpeciesTraits, SPECIES_COUNT> SPECIES_TRAITS = {{
+    {"Lion", Habitat::SAVANNA, 1000.0, 40.0, 60.0, {17, -10, -8}, "roaring"},
+    {"Bear", Habitat::FOREST, 800.0, 40.0, 60.0, {9, -8, -6}, "growling"},
+    {"Elephant", Habitat::SAVANNA, 1200.0, 50.0, 80.0, {15, -12, -11}, "trumpeting"},
+    {"Monkey", Habitat::JUNGLE, 600.0, 15.0, 25.0, {13, -15, -11}, "screeching"},
+    {"Penguin", Habitat::ARCTIC, 400.0, 10.0, 20.0, {12, -12, -8}, "squawking"},
+    {"Rabbit", Habitat::GRASSLAND, 150.0, 5.0, 8.0, {14, -10, -9}, "thumping"},
+    {"Tortoise", Habitat::GRASSLAND, 250.0, 6.0, 12.0, {9, -6, -5}, "hissing"},
+}};
+
+constexpr const SpeciesTraits& speciesTraits(Species species) {
+  return SPECIES_TRAITS[static_cast<size_t>(species)];
+}
+
+constexpr Habitat speciesHabitat(Species species) {
+  return speciesTraits(species).habitat;
+}
+
+// what an exhibit of each habitat costs, its capacity is rolled in [min, max] on purchase
+struct HabitatTraits {
+  int min_capacity;
+  int max_capacity;
+  double purchase_cost;
+  double maintenance_cost;
+};
+
+// one row per Habitat, in enum order, UNKNOWN can't be bought
+inline constexpr std::array<HabitatTraits, 6> HABITAT_TRAITS = {{
+    {0, 0, 0.0, 0.0},      // unknown
+    {2, 3, 300.0, 15.0},   // grassland
+    {3, 4, 600.0, 35.0},   // forest
+    {4, 6, 800.0, 45.0},   // jungle
+    {3, 5, 1000.0, 50.0},  // savanna
+    {4, 5, 1200.0, 60.0},  // arctic
+}};
+
+constexpr const HabitatTraits& habitatTraits(Habitat habitat) {
+  return HABITAT_TRAITS[static_cast<size_t>(habitat)];
+}
+
+using SpeciesMask = uint32_t;
+
+constexpr SpeciesMask speciesBit(Species species) {
+  return SpeciesMask{1} << static_cast<unsigned>(species);
+}
+
+constexpr int speciesMaskCount(SpeciesMask mask) {
+  return std::popcount(mask);
+}
+
+// species groups the missions ask for
+inline constexpr SpeciesMask MEDIUM_SPECIES =
+    speciesBit(Species::PENGUIN) | speciesBit(Species::MONKEY);
+inline constexpr SpeciesMask SPECIAL_SPECIES =
+    speciesBit(Species::BEAR) | speciesBit(Species::LION);
+
+const std::string& speciesName(Species species);
+
+std::string_view habitatName(Habitat habitat);
+Habitat habitatFromName(std::string_view name);
+
+#endif  // SPECIES_H
@@ -0,0 +1,59 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool shared by the library's parallel paths. Every worker owns a deque: tasks
+// submitted from a worker go to the back of its own deque and are popped LIFO, idle workers
+// steal from the front of the others. Threads waiting in parallelFor run queued tasks instead
+// of blocking, so nested parallel loops cannot deadlock.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t workers = defaultWorkerCount());
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // process-wide pool sized to the hardware
+  static ThreadPool& shared();
+  static size_t defaultWorkerCount();
+
+  size_t workerCount() const;
+
+  void submit(std::function<void()> task);
+
+  // Runs body(i) for every i in [0, count) on at most max_threads threads, the caller
+  // included, and returns once all of them have finished. Indices are handed out dynamically,
+  // so callers needing deterministic results must make body(i) independent of the thread.
+  void parallelFor(size_t count, size_t max_threads, const std::function<void(size_t)>& body);
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  bool runOneTask();
+  std::function<void()> popOwn(size_t index);
+  std::function<void()> steal(size_t first);
+  void workerLoop(size_t index);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> pending_{0};
+  std::atomic<size_t> next_queue_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+};
+
+#endif  // THREAD_POOL_H
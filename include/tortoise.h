@@ -8,9 +8,6 @@
 class Tortoise : public Animal {
  public:
   Tortoise(std::string name, int age);
-  void makeSound() const override;
-  void updateStatsEndOfDay() override;
-  std::string getPreferredHabitat() const override;
 };
 
 #endif  // TORTOISE_H
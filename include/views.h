@@ -0,0 +1,26 @@
+#ifndef VIEWS_H
+#define VIEWS_H
+
+#include <memory>
+#include <ranges>
+#include <span>
+
+// projects an owning pointer to the raw pointer the rest of the game works with
+struct RawPointer {
+  template <typename T>
+  T* operator()(const std::unique_ptr<T>& ptr) const {
+    return ptr.get();
+  }
+};
+
+// Random-access, sized view of raw pointers over contiguous owning pointers. Nothing is copied
+// or allocated; like an iterator, the view is invalidated by adding or removing elements.
+template <typename T>
+using PointerView = std::ranges::transform_view<std::span<const std::unique_ptr<T>>, RawPointer>;
+
+template <typename T>
+PointerView<T> makePointerView(std::span<const std::unique_ptr<T>> owners) {
+  return PointerView<T>(owners, RawPointer{});
+}
+
+#endif  // VIEWS_H
@@ -3,39 +3,100 @@
 
 #include <map>
 #include <memory>
+#include <ranges>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "animal.h"
+#include "animal_store.h"
+#include "event_sink.h"
 #include "exhibit.h"
+#include "handles.h"
+#include "rng.h"
+#include "screen_buffer.h"
+#include "species.h"
+#include "views.h"
+
+// figures derived from the zoo's state, cached until the state changes
+struct ZooMetrics {
+  double daily_expenses = 0.0;
+  double projected_balance = 0.0;
+  double rating = 0.0;
+  int visitor_count = 0;
+};
+
+using AnimalView = PointerView<Animal>;
+using ExhibitView = PointerView<Exhibit>;
+
+struct NeedsAttention {
+  bool operator()(const Animal* animal) const {
+    return animal->needsAttention();
+  }
+};
+
+struct NeedsCleaning {
+  bool operator()(const Exhibit* exhibit) const {
+    return exhibit->needsCleaning();
+  }
+};
+
+// lazily filtered views, evaluated while iterating
+using AnimalsNeedingAttention = std::ranges::filter_view<AnimalView, NeedsAttention>;
+using ExhibitsNeedingCleaning = std::ranges::filter_view<ExhibitView, NeedsCleaning>;
 
 class Zoo {
  public:
-  Zoo(std::string name, double starting_balance = 2000.0);
+  // the same seed replays the same game, see getRng
+  Zoo(std::string name, double starting_balance = 2000.0, uint64_t seed = 0);
 
   // getters
   const std::string& getName() const;
   int getDay() const;
   double getBalance() const;
 
+  // where the zoo, its exhibits and its animals report events, the console sink by default
+  EventSink& getEventSink() const;
+  void setEventSink(EventSink& sink);
+
+  // threads of the shared ThreadPool the end-of-day and visitor sweeps may use, results are
+  // the same for any count
+  size_t getWorkerCount() const;
+  void setWorkerCount(size_t workers);
+
+  // the one random source for everything rolled in this zoo's game
+  Rng& getRng();
+
   // animal management
   bool purchaseAnimal(std::unique_ptr<Animal> animal);
   bool sellAnimal(Animal* animal);
+  Animal* findAnimal(AnimalId id) const;
   std::vector<Animal*> getAllAnimals();
   std::vector<Animal*> getAnimalsNeedingAttention();
+  AnimalView animalView() const;
+  AnimalsNeedingAttention animalsNeedingAttention() const;
   size_t getAnimalCount() const;
+  size_t getSpeciesCount(Species species) const;
+  SpeciesMask getSpeciesMask() const;
+  // kept up to date as animals are placed and their stats change, so missions don't scan
+  size_t getPlacementCount(Placement placement) const;
+  ThresholdCounts getThresholdCounts() const;
 
   // exhibit management
   bool purchaseExhibit(std::unique_ptr<Exhibit> exhibit);
   bool sellExhibit(Exhibit* exhibit);
   Exhibit* getExhibit(size_t index);
+  Exhibit* findExhibit(ExhibitId id) const;
   std::vector<Exhibit*> getAllExhibits();
   std::vector<Exhibit*> getExhibitsNeedingCleaning();
+  ExhibitView exhibitView() const;
+  ExhibitsNeedingCleaning exhibitsNeedingCleaning() const;
   size_t getExhibitCount() const;
+  int getMinCleanliness() const;
+  size_t getDirtyExhibitCount() const;
 
   // animal-exhibit management
-  Exhibit* findAnimalLocation(Animal* animal);
+  Exhibit* findAnimalLocation(const Animal* animal) const;
   bool addAnimalToExhibit(Animal* animal, Exhibit* exhibit);
   bool removeAnimalFromExhibit(Animal* animal, Exhibit* exhibit);
   bool moveAnimalToExhibit(Animal* animal, Exhibit* exhibit);
@@ -49,24 +110,57 @@ class Zoo {
 
   // time and simulation
   void advanceDay();
-  double getProjectedBalance();
+  // Advances an idle zoo by `days`, with the same result as calling updateBalance,
+  // degradeStats and advanceDay that many times (the order Game ends a day in). Once a day
+  // leaves every stat, cleanliness and head count unchanged, the following days repeat it,
+  // so they're skipped in one step with the balance projected in closed form.
+  void fastForward(int days);
+  // see AnimalStore::setLazyDecay, on by default; animals catch up on the nights they missed
+  // when read
+  void setLazyDecay(bool lazy);
+  bool isLazyDecay() const;
+  double getProjectedBalance() const;
   void degradeStats();
   void displayEndOfDaySummary();
+  void renderEndOfDaySummary(ScreenBuffer& screen);
   void updateAnimalStats();
-  int calculateVisitorCount();
+  int calculateVisitorCount() const;
   double calculateDailyRevenue(int visitor_count) const;
   double calculateDailyExpenses() const;
-  double calculateZooRating();
+  double calculateZooRating() const;
   void viewZooRatingBreakdown();
+  uint64_t getEpoch() const;
+  const ZooMetrics& getMetrics() const;
+  double getAverageHappiness() const;
+  double getAverageHealth() const;
+  double getAverageCleanliness() const;
   std::string getRatingMessage(double rating);
 
  private:
+  bool ownsExhibit(const Exhibit* exhibit) const;
+  bool aggregatesMatch() const;
+  double computeDailyExpenses() const;
+  double computeProjectedBalance(double expenses) const;
+  double projectBalance(double balance, double expenses) const;
+  int repeatableDays(double revenue, double expenses, double financial_score, int days) const;
+  double computeZooRating(double projected_balance) const;
+  int computeVisitorCount(double rating) const;
+
   std::string name_;
   int day_;
   double balance_;
   double bonus_earned_ = 0.0;
-  std::vector<std::unique_ptr<Animal>> animals_;
-  std::vector<std::unique_ptr<Exhibit>> exhibits_;
+  AnimalStore animals_;  // owns every animal, with its stats and exhibit id
+  SlotMap<std::unique_ptr<Exhibit>, ExhibitTag> exhibits_;
+  ExhibitTotals exhibit_totals_;  // kept up to date by Exhibit::setCleanliness
+  uint64_t version_ = 0;          // bumped by zoo-level changes: balance, day, purchases
+  size_t workers_;
+  Rng rng_;
+  EventSink* sink_ = &consoleEventSink();
+
+  static constexpr uint64_t NO_EPOCH = UINT64_MAX;
+  mutable ZooMetrics metrics_;
+  mutable uint64_t metrics_epoch_ = NO_EPOCH;
 };
 
 #endif  // ZOO_H
@@ -4,7 +4,9 @@
 #include <iostream>
 #include <sstream>
 
-MissionSystem::MissionSystem(Zoo& zoo) : zoo_(zoo) {
+#include "mission_planner.h"
+
+MissionSystem::MissionSystem(Zoo& zoo, const Campaign& campaign) : zoo_(zoo), campaign_(&campaign) {
   setupDailyMissions(1);
 }
 
@@ -12,293 +14,125 @@ std::vector<Mission>& MissionSystem::getMissions() {
   return missions_;
 }
 
+const std::vector<Mission>& MissionSystem::getMissions() const {
+  return missions_;
+}
+
 std::set<Animal*> MissionSystem::getAnimalsFedToday() {
-  return animals_fed_today_;
+  std::set<Animal*> animals;
+  animals_fed_today_.forEach([&](AnimalId id) {
+    if (Animal* animal = zoo_.findAnimal(id)) {
+      animals.insert(animal);
+    }
+  });
+  return animals;
 }
 
 std::set<Exhibit*> MissionSystem::getExhibitsCleanedToday() {
-  return exhibits_cleaned_today_;
+  std::set<Exhibit*> exhibits;
+  exhibits_cleaned_today_.forEach([&](ExhibitId id) {
+    if (Exhibit* exhibit = zoo_.findExhibit(id)) {
+      exhibits.insert(exhibit);
+    }
+  });
+  return exhibits;
 }
 
-void MissionSystem::setupDailyMissions(int day) {
-  missions_.clear();
-
-  switch (day) {
-    case 1:
-      missions_.push_back(
-          Mission(true, "Purchase your first animal", MissionType::OWN_X_ANIMALS, 1));
-      missions_.push_back(
-          Mission(true, "Purchase your first exhibit", MissionType::OWN_X_EXHIBITS, 1));
-      missions_.push_back(
-          Mission(true, "Add your animal to the exhibit", MissionType::ADD_ANIMAL_TO_EXHIBIT));
-      missions_.push_back(Mission(false, "End day with balance of $1200+",
-                                  MissionType::BALANCE_AT_LEAST, 0, 1200.0, 100.0, true));
-      break;
-
-    case 2:
-      missions_.push_back(Mission(true, "Own 2 different species", MissionType::OWN_X_SPECIES, 2));
-      missions_.push_back(Mission(true, "Feed an animal", MissionType::FEED_X_ANIMALS, 1));
-      missions_.push_back(Mission(true, "End day with no homeless animals",
-                                  MissionType::NO_HOMELESS_ANIMALS, 0, 0.0, 0.0, true));
-      missions_.push_back(Mission(false, "End day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 100.0, true));
+const AnimalIdSet& MissionSystem::animalsFedToday() const {
+  return animals_fed_today_;
+}
 
-      break;
+const ExhibitIdSet& MissionSystem::exhibitsCleanedToday() const {
+  return exhibits_cleaned_today_;
+}
 
-    case 3:
-      missions_.push_back(Mission(true, "Own 3 different species", MissionType::OWN_X_SPECIES, 3));
-      missions_.push_back(Mission(true, "Own 2 exhibits", MissionType::OWN_X_EXHIBITS, 2));
-      missions_.push_back(Mission(true, "Feed 2 animals", MissionType::FEED_X_ANIMALS, 2));
-      missions_.push_back(
-          Mission(false, "Clean an exhibit", MissionType::CLEAN_X_EXHIBITS, 1, 0.0, 100.0));
+void MissionSystem::setCampaign(const Campaign& campaign) {
+  campaign_ = &campaign;
+  setupDailyMissions(zoo_.getDay());
+}
 
-      break;
+int MissionSystem::getDayCount() const {
+  return campaign_->getDayCount();
+}
 
-    case 4:
-      missions_.push_back(Mission(true, "Play with an animal", MissionType::PLAY_WITH_ANIMAL));
-      missions_.push_back(
-          Mission(true, "Feed all animals", MissionType::FEED_X_ANIMALS, zoo_.getAnimalCount()));
-      missions_.push_back(Mission(true, "All exhibits at 80+ cleanliness",
-                                  MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X, 80, 0.0, 0.0,
-                                  true));
-      missions_.push_back(Mission(true, "All animals in preferred habitats",
-                                  MissionType::PREFERRED_HABITATS, 0, 0.0, 0.0, true));
-      missions_.push_back(Mission(false, "End day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 100.0, true));
-      break;
+void MissionSystem::setupDailyMissions(int day) {
+  missions_.clear();
 
-    case 5:
-      missions_.push_back(Mission(true, "Own 4 different species", MissionType::OWN_X_SPECIES, 4));
-      missions_.push_back(Mission(true, "Own a penguin or monkey", MissionType::OWN_MEDIUM_ANIMAL));
-      missions_.push_back(Mission(true, "No homeless animals", MissionType::NO_HOMELESS_ANIMALS, 0,
-                                  0.0, 0.0, true));
-      missions_.push_back(Mission(false, "End day with balance of $800+",
-                                  MissionType::BALANCE_AT_LEAST, 0, 800.0, 100.0, true));
-      missions_.push_back(Mission(false, "End day with 40+ visitors",
-                                  MissionType::ATTRACT_X_VISITORS, 40, 0.0, 200.0, true));
-      break;
+  for (const MissionSpec& spec : campaign_->missionsFor(day)) {
+    int int_param = spec.all_animals ? static_cast<int>(zoo_.getAnimalCount()) : spec.int_param;
+    Mission& mission = missions_.emplace_back(spec.required, spec.description, spec.type, int_param,
+                                              spec.float_param, spec.reward, spec.end_of_day);
+    mission.predicate = campaign_->predicateFor(spec);
+  }
+}
 
-    case 6:
-      missions_.push_back(Mission(true, "Exercise an animal", MissionType::EXERCISE_ANIMAL));
-      missions_.push_back(
-          Mission(true, "Feed all animals", MissionType::FEED_X_ANIMALS, zoo_.getAnimalCount()));
-      missions_.push_back(Mission(true, "All exhibits at 80+ cleanliness",
-                                  MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X, 80, 0.0, 0.0,
-                                  true));
-      missions_.push_back(Mission(false, "End the day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 100.0, true));
-      missions_.push_back(
-          Mission(false, "Own 5 animals", MissionType::OWN_X_ANIMALS, 5, 0.0, 100.0));
-      break;
+MissionContext MissionSystem::makeContext() const {
+  MissionContext context;
+  context.animals = zoo_.getAnimalCount();
+  context.exhibits = zoo_.getExhibitCount();
+  context.species = zoo_.getSpeciesMask();
+  context.homeless = zoo_.getPlacementCount(Placement::HOMELESS);
+  context.misplaced = zoo_.getPlacementCount(Placement::OTHER_HABITAT);
+  ThresholdCounts thresholds = zoo_.getThresholdCounts();
+  context.sick = thresholds.sick;
+  context.needy = thresholds.neglected;
+  context.min_cleanliness = zoo_.getMinCleanliness();
+  context.dirty = zoo_.getDirtyExhibitCount();
+  context.balance = zoo_.getBalance();
+  return context;
+}
 
-    case 7:
-      missions_.push_back(Mission(true, "Own 3 exhibits", MissionType::OWN_X_EXHIBITS, 3));
-      missions_.push_back(Mission(true, "No animals need attention",
-                                  MissionType::NO_ANIMALS_NEED_ATTENTION, 0, 0.0, 0.0, true));
-      missions_.push_back(Mission(false, "End day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 200.0, true));
-      missions_.push_back(Mission(false, "End day with balance of $1500+",
-                                  MissionType::BALANCE_AT_LEAST, 0, 1000.0, 100.0, true));
-      missions_.push_back(Mission(false, "All animals in preferred habitats",
-                                  MissionType::PREFERRED_HABITATS, 0, 0.0, 200.0, true));
-      break;
+MissionVars MissionSystem::makeVars(const MissionContext& context, bool with_metrics) const {
+  MissionVars vars{};
+  auto set = [&vars](MissionVar var, double value) { vars[static_cast<size_t>(var)] = value; };
+  set(MissionVar::ANIMALS, context.animals);
+  set(MissionVar::EXHIBITS, context.exhibits);
+  set(MissionVar::SPECIES, speciesMaskCount(context.species));
+  set(MissionVar::HOMELESS, context.homeless);
+  set(MissionVar::MISPLACED, context.misplaced);
+  set(MissionVar::SICK, context.sick);
+  set(MissionVar::NEEDY, context.needy);
+  set(MissionVar::MIN_CLEANLINESS, context.min_cleanliness);
+  set(MissionVar::DIRTY, context.dirty);
+  set(MissionVar::BALANCE, context.balance);
+  set(MissionVar::FED, animals_fed_today_.size());
+  set(MissionVar::CLEANED, exhibits_cleaned_today_.size());
+  set(MissionVar::PLAYED, played_with_animal_today_);
+  set(MissionVar::EXERCISED, exercised_animal_today_);
+  set(MissionVar::SPECIES_MASK, context.species);
+  // the metrics are recomputed after every change, so only when a predicate reads them
+  if (with_metrics) {
+    set(MissionVar::PROJECTED_BALANCE, zoo_.getProjectedBalance());
+    set(MissionVar::RATING, zoo_.calculateZooRating());
+    set(MissionVar::VISITORS, zoo_.calculateVisitorCount());
+  }
+  return vars;
+}
 
-    case 8:
-      missions_.push_back(Mission(true, "Own 5 different species", MissionType::OWN_X_SPECIES, 5));
-      missions_.push_back(
-          Mission(true, "Feed all animals", MissionType::FEED_X_ANIMALS, zoo_.getAnimalCount()));
-      missions_.push_back(Mission(false, "End day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 200.0, true));
-      missions_.push_back(Mission(false, "End day with balance of $1500+",
-                                  MissionType::BALANCE_AT_LEAST, 0, 1500.0, 150.0, true));
-      missions_.push_back(
-          Mission(false, "Own a bear or lion", MissionType::OWN_SPECIAL_ANIMAL, 0, 0.0, 250.0));
-      break;
+static const PredicateProgram& predicateOf(const Mission& mission) {
+  return mission.predicate ? *mission.predicate : defaultPredicate(mission.type);
+}
 
-    case 9:
-      missions_.push_back(Mission(true, "Own 6 different species", MissionType::OWN_X_SPECIES, 6));
-      missions_.push_back(Mission(true, "No animals need attention",
-                                  MissionType::NO_ANIMALS_NEED_ATTENTION, 0, 0.0, 0.0, true));
-      missions_.push_back(Mission(true, "All exhibits at 80+ cleanliness",
-                                  MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X, 80, 0.0, 0.0,
-                                  true));
-      missions_.push_back(Mission(false, "End day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 200.0, true));
-      missions_.push_back(Mission(false, "End day with 60+ visitors",
-                                  MissionType::ATTRACT_X_VISITORS, 60, 0.0, 250.0, true));
-      break;
+void MissionSystem::checkMissions(bool end_of_day) {
+  // don't check end of day missions unless end of day
+  auto due = [end_of_day](const Mission& mission) {
+    return !mission.completed && (end_of_day || !mission.end_of_day);
+  };
 
-    case 10:
-      missions_.push_back(Mission(true, "No homeless animals", MissionType::NO_HOMELESS_ANIMALS));
-      missions_.push_back(Mission(true, "All animals are in preferred habitats",
-                                  MissionType::PREFERRED_HABITATS, 0, 0.0, 0.0, true));
-      missions_.push_back(
-          Mission(true, "No sick animals", MissionType::NO_SICK_ANIMALS, 0, 0.0, 0.0, true));
-      missions_.push_back(Mission(true, "No animals need attention",
-                                  MissionType::NO_ANIMALS_NEED_ATTENTION, 0, 0.0, 0.0, true));
-      missions_.push_back(
-          Mission(false, "Own 7 different species", MissionType::OWN_X_SPECIES, 7, 0.0, 250.0));
-      missions_.push_back(
-          Mission(false, "Own an elephant", MissionType::OWN_ELEPHANT, 0, 0.0, 200.0));
-      missions_.push_back(Mission(false, "End day with zoo rating of 4.0+",
-                                  MissionType::ZOO_RATING_ABOVE, 0, 4.0, 200.0, true));
-      missions_.push_back(Mission(false, "Balance above $2000", MissionType::BALANCE_AT_LEAST, 0,
-                                  2000.0, 200.0, true));
-      break;
+  bool with_metrics = false;
+  for (const Mission& mission : missions_) {
+    with_metrics |= due(mission) && predicateOf(mission).reads_metrics;
   }
-}
+  MissionVars vars = makeVars(makeContext(), with_metrics);
 
-void MissionSystem::checkMissions(bool end_of_day) {
   for (size_t i = 0; i < missions_.size(); ++i) {
     Mission& mission = missions_[i];
-    if (mission.completed) {
-      continue;
-    }
-
-    // don't check end of day missions unless end of day
-    if (mission.end_of_day && !end_of_day) {
+    if (!due(mission)) {
       continue;
     }
 
-    bool condition_met = false;
-
-    switch (mission.type) {
-      case MissionType::ADD_ANIMAL_TO_EXHIBIT:
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          if (zoo_.findAnimalLocation(animal)) {
-            condition_met = true;
-            break;
-          }
-        }
-        break;
-
-      case MissionType::OWN_X_ANIMALS:
-        condition_met = zoo_.getAnimalCount() >= static_cast<size_t>(mission.int_param);
-        break;
-
-      case MissionType::OWN_X_SPECIES: {
-        std::set<std::string> species;
-        for (const Animal* animal : zoo_.getAllAnimals()) {
-          species.insert(animal->getSpecies());
-        }
-        condition_met = species.size() >= static_cast<size_t>(mission.int_param);
-        break;
-      }
-
-      case MissionType::OWN_X_EXHIBITS:
-        condition_met = zoo_.getExhibitCount() >= static_cast<size_t>(mission.int_param);
-        break;
-
-      case MissionType::FEED_X_ANIMALS:
-        condition_met = (animals_fed_today_.size() == static_cast<size_t>(mission.int_param));
-        break;
-
-      case MissionType::PLAY_WITH_ANIMAL:
-        condition_met = played_with_animal_today_;
-        break;
-
-      case MissionType::EXERCISE_ANIMAL:
-        condition_met = exercised_animal_today_;
-        break;
-
-      case MissionType::NO_ANIMALS_NEED_ATTENTION:
-        condition_met = zoo_.getAnimalsNeedingAttention().empty();
-        break;
-
-      case MissionType::NO_SICK_ANIMALS:
-        condition_met = true;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->getHealthLevel() < 50) {
-            condition_met = false;
-            break;
-          }
-        }
-        break;
-
-      case MissionType::NO_HOMELESS_ANIMALS:
-        condition_met = true;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          if (zoo_.findAnimalLocation(animal) == nullptr) {
-            condition_met = false;
-            break;
-          }
-        }
-        break;
-
-      case MissionType::PREFERRED_HABITATS:
-        condition_met = true;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          Exhibit* exhibit = zoo_.findAnimalLocation(animal);
-          if (!exhibit || exhibit->getType() != animal->getPreferredHabitat()) {
-            condition_met = false;
-            break;
-          }
-        }
-        break;
-
-      case MissionType::CLEAN_X_EXHIBITS:
-        condition_met = exhibits_cleaned_today_.size() >= static_cast<size_t>(mission.int_param);
-        break;
-
-      case MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X:
-        condition_met = true;
-        for (Exhibit* exhibit : zoo_.getAllExhibits()) {
-          if (exhibit->getCleanliness() < mission.int_param) {
-            condition_met = false;
-            break;
-          }
-        }
-        break;
-
-      case MissionType::BALANCE_AT_LEAST:
-        condition_met = zoo_.getProjectedBalance() >= mission.float_param;
-        break;
-
-      case MissionType::ZOO_RATING_ABOVE:
-        condition_met = zoo_.calculateZooRating() >= mission.float_param;
-        break;
-
-      case MissionType::ATTRACT_X_VISITORS:
-        condition_met = zoo_.calculateVisitorCount() >= mission.int_param;
-        break;
-
-      case MissionType::OWN_ELEPHANT:
-        for (const Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->getSpecies() == "Elephant") {
-            condition_met = true;
-            break;
-          }
-        }
-        break;
-
-      case MissionType::OWN_MEDIUM_ANIMAL: {
-        bool owns_penguin = false;
-        bool owns_monkey = false;
-        for (const Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->getSpecies() == "Penguin") {
-            owns_penguin = true;
-          } else if (animal->getSpecies() == "Monkey") {
-            owns_monkey = true;
-          }
-        }
-        condition_met = owns_penguin || owns_monkey;
-        break;
-      }
+    bool condition_met = predicateOf(mission).evaluate(vars, mission);
 
-      case MissionType::OWN_SPECIAL_ANIMAL: {
-        bool owns_bear = false;
-        bool owns_lion = false;
-        for (const Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->getSpecies() == "Bear") {
-            owns_bear = true;
-          } else if (animal->getSpecies() == "Lion") {
-            owns_lion = true;
-          }
-        }
-        condition_met = owns_bear || owns_lion;
-        break;
-      }
-    }
     // don't mark end of day missions complete until end of day
     if (mission.end_of_day) {
       mission.condition_met = condition_met;
@@ -312,7 +146,7 @@ void MissionSystem::completeMission(size_t mission_index) {
   Mission& mission = missions_[mission_index];
   mission.completed = true;
 
-  std::cout << "\nMission Complete: " << mission.description << "\n";
+  zoo_.getEventSink().emit({.type = EventType::MISSION_COMPLETED, .subject = mission.description});
 
   if (mission.reward_amount > 0) {
     zoo_.addMoney(mission.reward_amount);
@@ -321,20 +155,27 @@ void MissionSystem::completeMission(size_t mission_index) {
 }
 
 void MissionSystem::displayMissions(bool show_status) {
-  std::cout << "\nDAY " << zoo_.getDay() << " MISSIONS\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  ScreenBuffer screen(std::cout);
+  renderMissions(screen, show_status);
+  screen.flush();
+}
+
+void MissionSystem::renderMissions(ScreenBuffer& screen, bool show_status) {
+  screen << "\nDAY " << zoo_.getDay() << " MISSIONS\n";
+  screen << "----------------------------------------------------------------------\n";
 
-  std::cout << "Required:\n";
+  MissionContext context = makeContext();
+  screen << "Required:\n";
   for (const Mission& mission : missions_) {
     if (mission.required) {
-      std::cout << " - " << mission.description << getMissionProgress(mission);
+      screen << " - " << mission.description << getMissionProgress(mission, context);
 
       if (mission.completed) {
-        std::cout << " ✓\n";
+        screen << " ✓\n";
       } else if (mission.end_of_day && !show_status) {
-        std::cout << " ?\n";
+        screen << " ?\n";
       } else {
-        std::cout << " X\n";
+        screen << " X\n";
       }
     }
   }
@@ -348,22 +189,22 @@ void MissionSystem::displayMissions(bool show_status) {
   }
 
   if (has_optional) {
-    std::cout << "\nOptional (Complete for bonus rewards, checked at end of day):\n";
+    screen << "\nOptional (Complete for bonus rewards, checked at end of day):\n";
     for (const Mission& mission : missions_) {
       if (!mission.required) {
-        std::cout << " - " << mission.description << getMissionProgress(mission);
-        std::cout << " -> $" << mission.reward_amount;
+        screen << " - " << mission.description << getMissionProgress(mission, context);
+        screen << " -> $" << mission.reward_amount;
 
         if (show_status && mission.completed) {
-          std::cout << " ✓";
+          screen << " ✓";
         } else if (show_status && !mission.completed) {
-          std::cout << " X";
+          screen << " X";
         }
-        std::cout << "\n";
+        screen << "\n";
       }
     }
   }
-  std::cout << "----------------------------------------------------------------------\n";
+  screen << "----------------------------------------------------------------------\n";
 }
 
 bool MissionSystem::canAdvanceDay() {
@@ -386,201 +227,69 @@ bool MissionSystem::canAdvanceDay() {
 }
 
 bool MissionSystem::checkMissionsImpossible(int action_points) {
-  for (const Mission& mission : missions_) {
-    if (!mission.required || mission.completed) {
-      continue;
-    }
-
-    switch (mission.type) {
-      case MissionType::ADD_ANIMAL_TO_EXHIBIT: {
-        // need at least one animal and one exhibit
-        if (zoo_.getAnimalCount() == 0 || zoo_.getExhibitCount() == 0) {
-          double balance_needed = 0.0;
-          if (zoo_.getAnimalCount() == 0) {
-            balance_needed += 150.0;
-          }
-          if (zoo_.getExhibitCount() == 0) {
-            balance_needed += 300.0;
-          }
-          if (zoo_.getBalance() < balance_needed) {
-            return true;
-          }
-        }
-        break;
-      }
-
-      case MissionType::OWN_X_ANIMALS: {
-        std::set<std::string> species;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          species.insert(animal->getSpecies());
-        }
-        int animals_needed = mission.int_param - zoo_.getAnimalCount();
-        if (zoo_.getBalance() < (animals_needed * 150.0)) {
-          return true;
-        }
-        break;
-      }
-
-      case MissionType::OWN_X_SPECIES: {
-        std::set<std::string> species;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          species.insert(animal->getSpecies());
-        }
-        int species_needed = mission.int_param - species.size();
-        if (zoo_.getBalance() < (species_needed * 150.0)) {
-          return true;
-        }
-        break;
-      }
-
-      case MissionType::OWN_X_EXHIBITS: {
-        int exhibits_needed = mission.int_param - zoo_.getExhibitCount();
-        if (zoo_.getBalance() < (exhibits_needed * 300.0)) {
-          return true;
-        }
-        break;
-      }
-
-      case MissionType::NO_ANIMALS_NEED_ATTENTION: {
-        int needy_animals = 0;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->needsAttention()) {
-            needy_animals++;
-          }
-        }
-        // estimated treatment cost: treatment ($50) + feeding ($5-50)
-        double treatment_cost = needy_animals * 100.0;
-        if (zoo_.getBalance() < treatment_cost && action_points == 0) {
-          return true;
-        }
-        break;
-      }
-
-      case MissionType::NO_SICK_ANIMALS: {
-        int sick_animals = 0;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->getHealthLevel() < 50) {
-            sick_animals++;
-          }
-        }
-        // estimated treatment cost: treatment ($50) + feeding ($5-50)
-        double treatment_cost = sick_animals * 100.0;
-        if (zoo_.getBalance() < treatment_cost && action_points == 0) {
-          return true;
-        }
-        break;
-      }
-
-      case MissionType::OWN_MEDIUM_ANIMAL: {
-        bool owns_penguin = false;
-        bool owns_monkey = false;
-        for (Animal* animal : zoo_.getAllAnimals()) {
-          if (animal->getSpecies() == "Penguin") {
-            owns_penguin = true;
-          } else if (animal->getSpecies() == "Monkey") {
-            owns_monkey = true;
-          }
-        }
-        if (!owns_penguin && !owns_monkey) {
-          if (zoo_.getBalance() < 400.0) {
-            return true;
-          }
-        }
-        break;
-      }
-
-      default:
-        break;
-    }
-  }
-  return false;
+  DayProgress progress{animals_fed_today_, exhibits_cleaned_today_, played_with_animal_today_,
+                       exercised_animal_today_};
+  return !requiredMissionsFeasible(zoo_, makeContext(), missions_, progress, action_points);
 }
 
 std::string MissionSystem::getMissionProgress(const Mission& mission) {
+  return getMissionProgress(mission, makeContext());
+}
+
+std::string MissionSystem::getMissionProgress(const Mission& mission,
+                                              const MissionContext& context) {
   switch (mission.type) {
     case MissionType::OWN_X_ANIMALS:
-      return " [" + std::to_string(zoo_.getAnimalCount()) + "/" +
-             std::to_string(mission.int_param) + "]";
+      return " [" + std::to_string(context.animals) + "/" + std::to_string(mission.int_param) + "]";
 
     case MissionType::OWN_X_EXHIBITS:
-      return " [" + std::to_string(zoo_.getExhibitCount()) + "/" +
-             std::to_string(mission.int_param) + "]";
+      return " [" + std::to_string(context.exhibits) + "/" + std::to_string(mission.int_param) +
+             "]";
 
     case MissionType::OWN_X_SPECIES: {
-      std::set<std::string> species;
-      for (Animal* animal : zoo_.getAllAnimals()) {
-        species.insert(animal->getSpecies());
-      }
-      return " [" + std::to_string(species.size()) + "/" + std::to_string(mission.int_param) + "]";
+      int species = speciesMaskCount(context.species);
+      return " [" + std::to_string(species) + "/" + std::to_string(mission.int_param) + "]";
     }
 
-    case MissionType::FEED_X_ANIMALS:
-      if (animals_fed_today_.size() >= static_cast<size_t>(mission.int_param)) {
+    case MissionType::FEED_X_ANIMALS: {
+      size_t fed = animals_fed_today_.size();
+      if (fed >= static_cast<size_t>(mission.int_param)) {
         return "";
       }
-      return " [" + std::to_string(animals_fed_today_.size()) + "/" +
-             std::to_string(mission.int_param) + " fed]";
+      return " [" + std::to_string(fed) + "/" + std::to_string(mission.int_param) + " fed]";
+    }
 
     case MissionType::NO_ANIMALS_NEED_ATTENTION:
-      if (zoo_.getAnimalsNeedingAttention().empty()) {
+      if (context.needy == 0) {
         return "";
       }
-      return " [" + std::to_string(zoo_.getAnimalsNeedingAttention().size()) + "]";
+      return " [" + std::to_string(context.needy) + "]";
 
-    case MissionType::NO_SICK_ANIMALS: {
-      int sick_animals = 0;
-      for (Animal* animal : zoo_.getAllAnimals()) {
-        if (animal->getHealthLevel() < 50) {
-          sick_animals++;
-        }
-      }
-      return " [" + std::to_string(sick_animals) + " sick]";
-    }
+    case MissionType::NO_SICK_ANIMALS:
+      return " [" + std::to_string(context.sick) + " sick]";
 
-    case MissionType::NO_HOMELESS_ANIMALS: {
-      int homeless_animals = 0;
-      for (Animal* animal : zoo_.getAllAnimals()) {
-        if (zoo_.findAnimalLocation(animal) == nullptr) {
-          homeless_animals++;
-        }
-      }
-      return " [" + std::to_string(homeless_animals) + " homeless]";
-    }
+    case MissionType::NO_HOMELESS_ANIMALS:
+      return " [" + std::to_string(context.homeless) + " homeless]";
 
-    case MissionType::PREFERRED_HABITATS: {
-      int wrong_habitat = 0;
-      for (Animal* animal : zoo_.getAllAnimals()) {
-        Exhibit* exhibit = zoo_.findAnimalLocation(animal);
-        if (exhibit && exhibit->getType() != animal->getPreferredHabitat()) {
-          wrong_habitat++;
-        }
-      }
-      if (wrong_habitat == 0) {
+    case MissionType::PREFERRED_HABITATS:
+      if (context.misplaced == 0) {
         return "";
       }
-      return " [" + std::to_string(wrong_habitat) + " wrong]";
-    }
+      return " [" + std::to_string(context.misplaced) + " wrong]";
 
     case MissionType::CLEAN_X_EXHIBITS:
       return " [" + std::to_string(exhibits_cleaned_today_.size()) + "/" +
              std::to_string(mission.int_param) + " cleaned]";
 
-    case MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X: {
-      int dirty_exhibits = 0;
-      for (Exhibit* exhibits : zoo_.getAllExhibits()) {
-        if (exhibits->getCleanliness() < 50) {
-          dirty_exhibits++;
-        }
-      }
-      if (dirty_exhibits == 0) {
+    case MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X:
+      if (context.dirty == 0) {
         return "";
       }
-      return " [" + std::to_string(dirty_exhibits) + " dirty]";
-    }
+      return " [" + std::to_string(context.dirty) + " dirty]";
 
     case MissionType::BALANCE_AT_LEAST: {
       std::ostringstream ss;
-      ss << "$" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "/$"
+      ss << "$" << std::fixed << std::setprecision(0) << context.balance << "/$"
          << mission.float_param;
       return " [" + ss.str() + "]";
     }
@@ -601,11 +310,15 @@ std::string MissionSystem::getMissionProgress(const Mission& mission) {
 }
 
 void MissionSystem::trackAnimalFed(Animal* animal) {
-  animals_fed_today_.insert(animal);
+  if (animal) {
+    animals_fed_today_.insert(animal->getId());
+  }
 }
 
 void MissionSystem::trackExhibitCleaned(Exhibit* exhibit) {
-  exhibits_cleaned_today_.insert(exhibit);
+  if (exhibit) {
+    exhibits_cleaned_today_.insert(exhibit->getId());
+  }
 }
 
 void MissionSystem::trackPlayedWithAnimal() {
@@ -4,17 +4,22 @@
 #include <iostream>
 #include <utility>
 
-Animal::Animal(std::string name, std::string species, int age)
+Animal::Animal(std::string name, Species species, int age)
     : name_(std::move(name)),
-      species_(std::move(species)),
+      species_id_(species),
       age_(age),
-      health_(100),
-      hunger_(0),
-      happiness_(100),
-      energy_(100),
-      purchase_cost_(0.0),
-      feeding_cost_(0.0),
-      maintenance_cost_(0.0) {}
+      purchase_cost_(speciesTraits(species).purchase_cost),
+      feeding_cost_(speciesTraits(species).feeding_cost),
+      maintenance_cost_(speciesTraits(species).maintenance_cost),
+      stats_{100, 0, 100, 100} {}
+
+void* Animal::operator new(size_t size) {
+  return poolAllocate(size);
+}
+
+void Animal::operator delete(void* ptr, size_t size) noexcept {
+  poolDeallocate(ptr, size);
+}
 
 // getters
 const std::string& Animal::getName() const {
@@ -22,7 +27,27 @@ const std::string& Animal::getName() const {
 }
 
 const std::string& Animal::getSpecies() const {
-  return species_;
+  return speciesName(species_id_);
+}
+
+Species Animal::getSpeciesId() const {
+  return species_id_;
+}
+
+const SpeciesTraits& Animal::getTraits() const {
+  return speciesTraits(species_id_);
+}
+
+Habitat Animal::getHabitat() const {
+  return speciesHabitat(species_id_);
+}
+
+std::string_view Animal::getPreferredHabitat() const {
+  return habitatName(getHabitat());
+}
+
+AnimalId Animal::getId() const {
+  return id_;
 }
 
 int Animal::getAge() const {
@@ -30,28 +55,29 @@ int Animal::getAge() const {
 }
 
 int Animal::getHealthLevel() const {
-  return health_;
+  return getStat(AnimalStat::HEALTH);
 }
 
 int Animal::getHungerLevel() const {
-  return hunger_;
+  return getStat(AnimalStat::HUNGER);
 }
 
 int Animal::getHappinessLevel() const {
-  return happiness_;
+  return getStat(AnimalStat::HAPPINESS);
 }
 
 int Animal::getEnergyLevel() const {
-  return energy_;
+  return getStat(AnimalStat::ENERGY);
 }
 
 bool Animal::isAlive() const {
-  return health_ > 0;
+  return getHealthLevel() > 0;
 }
 
 bool Animal::needsAttention() const {
-  return health_ < CRITICAL_THRESHOLD || hunger_ > (MAX_STAT - CRITICAL_THRESHOLD) ||
-         happiness_ < CRITICAL_THRESHOLD || energy_ < CRITICAL_THRESHOLD;
+  return getHealthLevel() < CRITICAL_THRESHOLD ||
+         getHungerLevel() > (MAX_STAT - CRITICAL_THRESHOLD) ||
+         getHappinessLevel() < CRITICAL_THRESHOLD || getEnergyLevel() < CRITICAL_THRESHOLD;
 }
 
 double Animal::getPurchaseCost() const {
@@ -70,21 +96,41 @@ int Animal::clamp(int value, int min_val, int max_val) {
   return std::max(min_val, std::min(value, max_val));
 }
 
+int Animal::getStat(AnimalStat stat) const {
+  if (store_) {
+    return store_->get(slot_, stat);
+  }
+  return stats_[static_cast<size_t>(stat)];
+}
+
+void Animal::updateStat(AnimalStat stat, int delta) {
+  int value = clamp(getStat(stat) + delta, MIN_STAT, MAX_STAT);
+  if (store_) {
+    store_->set(slot_, stat, value);
+  } else {
+    stats_[static_cast<size_t>(stat)] = value;
+  }
+}
+
 // setters
 void Animal::updateHealth(int delta) {
-  health_ = clamp(health_ + delta, MIN_STAT, MAX_STAT);
+  updateStat(AnimalStat::HEALTH, delta);
 }
 
 void Animal::updateHunger(int delta) {
-  hunger_ = clamp(hunger_ + delta, MIN_STAT, MAX_STAT);
+  updateStat(AnimalStat::HUNGER, delta);
 }
 
 void Animal::updateHappiness(int delta) {
-  happiness_ = clamp(happiness_ + delta, MIN_STAT, MAX_STAT);
+  updateStat(AnimalStat::HAPPINESS, delta);
 }
 
 void Animal::updateEnergy(int delta) {
-  energy_ = clamp(energy_ + delta, MIN_STAT, MAX_STAT);
+  updateStat(AnimalStat::ENERGY, delta);
+}
+
+EventSink& Animal::eventSink() const {
+  return store_ ? store_->eventSink() : consoleEventSink();
 }
 
 void Animal::setName(const std::string& name) {
@@ -93,14 +139,29 @@ void Animal::setName(const std::string& name) {
 
 void Animal::eat(int amount) {
   if (amount <= 0) {
-    std::cout << getName() << " needs a positive amount of food!\n";
+    eventSink().emit({.type = EventType::FOOD_REFUSED, .subject = getName()});
     return;
   }
 
   updateHunger(-amount);
   updateHappiness(5);
   updateEnergy(5);
-  std::cout << getName() << " the " << getSpecies() << " is eating.\n";
+  eventSink().emit({.type = EventType::ANIMAL_ATE, .subject = getName(), .species = getSpecies()});
+}
+
+void Animal::makeSound() const {
+  std::cout << getName() << " the " << getSpecies() << " is " << getTraits().sound << "!\n";
+}
+
+DailyDecay Animal::getDailyDecay() const {
+  return getTraits().decay;
+}
+
+void Animal::updateStatsEndOfDay() {
+  DailyDecay decay = getDailyDecay();
+  updateHunger(decay.hunger);
+  updateHappiness(decay.happiness);
+  updateEnergy(decay.energy);
 }
 
 void Animal::sleep() {
@@ -0,0 +1,620 @@
+#include "animal_store.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "animal.h"
+#include "thread_pool.h"
+
+static size_t chunkCount(size_t count) {
+  return (count + AnimalStore::SWEEP_CHUNK - 1) / AnimalStore::SWEEP_CHUNK;
+}
+
+// runs fn(chunk) for every chunk index on up to `workers` threads of the shared pool
+static void forEachChunk(size_t chunks, size_t workers, const std::function<void(size_t)>& fn) {
+  ThreadPool::shared().parallelFor(chunks, workers, fn);
+}
+
+AnimalStore::~AnimalStore() = default;
+
+AnimalId AnimalStore::insert(std::unique_ptr<Animal> animal) {
+  if (!animal || animal->store_) {
+    return {};
+  }
+
+  AnimalId id = ids_.insert();
+  for (size_t stat = 0; stat < ANIMAL_STAT_COUNT; ++stat) {
+    stats_[stat].push_back(animal->stats_[stat]);
+    tally_.totals[stat] += animal->stats_[stat];
+  }
+  Species species = animal->getSpeciesId();
+  species_counts_[static_cast<size_t>(species)]++;
+  species_.push_back(species);
+  exhibit_.push_back({});
+  home_.push_back(Placement::HOMELESS);
+  settled_.push_back(night_);
+  booked_.push_back(UNBOOKED);
+  stamp_.push_back(0);
+  placement_counts_[static_cast<size_t>(Placement::HOMELESS)]++;
+  countThresholds(tally_, thresholdsAt(animals_.size()), 1);
+  tally_.changes++;
+
+  animal->store_ = this;
+  animal->slot_ = animals_.size();
+  animal->id_ = id;
+  animals_.push_back(std::move(animal));
+  version_++;
+  if (lazy_) {
+    unplanned_.push_back(id);
+  }
+  return id;
+}
+
+std::unique_ptr<Animal> AnimalStore::remove(AnimalId id) {
+  if (!ids_.contains(id)) {
+    return nullptr;
+  }
+
+  if (lazy_) {
+    touch(ids_.denseIndex(id));
+  }
+  auto erased = ids_.erase(id);
+  size_t slot = erased.hole;
+  std::unique_ptr<Animal> animal = std::move(animals_[slot]);
+  for (size_t stat = 0; stat < ANIMAL_STAT_COUNT; ++stat) {
+    animal->stats_[stat] = stats_[stat][slot];
+    tally_.totals[stat] -= stats_[stat][slot];
+  }
+  species_counts_[static_cast<size_t>(species_[slot])]--;
+  placement_counts_[static_cast<size_t>(home_[slot])]--;
+  countThresholds(tally_, thresholdsAt(slot), -1);
+  tally_.changes++;
+  animal->store_ = nullptr;
+  animal->slot_ = 0;
+  animal->id_ = {};
+
+  // move the last slot into the hole so the columns stay packed
+  size_t last = erased.last;
+  if (slot != last) {
+    for (auto& column : stats_) {
+      column[slot] = column[last];
+    }
+    species_[slot] = species_[last];
+    exhibit_[slot] = exhibit_[last];
+    home_[slot] = home_[last];
+    settled_[slot] = settled_[last];
+    booked_[slot] = booked_[last];
+    stamp_[slot] = stamp_[last];
+    animals_[slot] = std::move(animals_[last]);
+    animals_[slot]->slot_ = slot;
+  }
+
+  for (auto& column : stats_) {
+    column.pop_back();
+  }
+  species_.pop_back();
+  exhibit_.pop_back();
+  home_.pop_back();
+  settled_.pop_back();
+  booked_.pop_back();
+  stamp_.pop_back();
+  animals_.pop_back();
+  version_++;
+  return animal;
+}
+
+Animal* AnimalStore::find(AnimalId id) const {
+  if (!ids_.contains(id)) {
+    return nullptr;
+  }
+  return animals_[ids_.denseIndex(id)].get();
+}
+
+bool AnimalStore::contains(const Animal& animal) const {
+  return animal.store_ == this;
+}
+
+Animal* AnimalStore::at(size_t slot) const {
+  return animals_[slot].get();
+}
+
+size_t AnimalStore::size() const {
+  return animals_.size();
+}
+
+std::span<const std::unique_ptr<Animal>> AnimalStore::animals() const {
+  return animals_;
+}
+
+int AnimalStore::get(size_t slot, AnimalStat stat) const {
+  if (lazy_) {
+    settle(slot);
+  }
+  return stats_[static_cast<size_t>(stat)][slot];
+}
+
+void AnimalStore::set(size_t slot, AnimalStat stat, int value) {
+  if (lazy_) {
+    touch(slot);
+  }
+  uint8_t before = thresholdsAt(slot);
+  int& current = stats_[static_cast<size_t>(stat)][slot];
+  tally_.totals[static_cast<size_t>(stat)] += value - current;
+  tally_.changes += value != current;
+  current = value;
+  uint8_t after = thresholdsAt(slot);
+  if (after != before) {
+    countThresholds(tally_, before, -1);
+    countThresholds(tally_, after, 1);
+  }
+  version_++;
+}
+
+int64_t AnimalStore::total(AnimalStat stat) const {
+  return tally_.totals[static_cast<size_t>(stat)];
+}
+
+// lazy mode counts the slots each booked night changes, so only eager mode keeps a copy
+void AnimalStore::markStats() {
+  marked_changes_ = tally_.changes;
+  marked_stats_.clear();
+  if (lazy_) {
+    return;
+  }
+  for (const auto& column : stats_) {
+    marked_stats_.insert(marked_stats_.end(), column.begin(), column.end());
+  }
+}
+
+bool AnimalStore::statsChangedSinceMark() const {
+  if (lazy_) {
+    return tally_.changes != marked_changes_;
+  }
+  if (marked_stats_.size() != ANIMAL_STAT_COUNT * animals_.size()) {
+    return true;
+  }
+  auto next = marked_stats_.begin();
+  for (const auto& column : stats_) {
+    if (!std::equal(column.begin(), column.end(), next)) {
+      return true;
+    }
+    next += column.size();
+  }
+  return false;
+}
+
+StatCounts AnimalStore::countStats(size_t workers) const {
+  if (lazy_) {
+    return {static_cast<size_t>(tally_.happy), static_cast<size_t>(tally_.neglected)};
+  }
+  const int* health = stats_[static_cast<size_t>(AnimalStat::HEALTH)].data();
+  const int* hunger = stats_[static_cast<size_t>(AnimalStat::HUNGER)].data();
+  const int* happiness = stats_[static_cast<size_t>(AnimalStat::HAPPINESS)].data();
+  const int* energy = stats_[static_cast<size_t>(AnimalStat::ENERGY)].data();
+
+  constexpr int CRITICAL = Animal::CRITICAL_THRESHOLD;
+  constexpr int STARVING = Animal::MAX_STAT - Animal::CRITICAL_THRESHOLD;
+
+  size_t count = animals_.size();
+  std::vector<StatCounts> chunk_counts(chunkCount(count));
+  forEachChunk(chunk_counts.size(), workers, [&](size_t chunk) {
+    size_t begin = chunk * SWEEP_CHUNK;
+    size_t end = std::min(begin + SWEEP_CHUNK, count);
+
+    // branch-free so the compiler can vectorize the sweep
+    size_t happy = 0;
+    size_t neglected = 0;
+    for (size_t i = begin; i < end; ++i) {
+      happy += happiness[i] > 80;
+      neglected += (health[i] < CRITICAL) | (hunger[i] > STARVING) | (happiness[i] < CRITICAL) |
+                   (energy[i] < CRITICAL);
+    }
+    chunk_counts[chunk] = {happy, neglected};
+  });
+
+  StatCounts counts;
+  for (const StatCounts& chunk : chunk_counts) {
+    counts.happy += chunk.happy;
+    counts.neglected += chunk.neglected;
+  }
+  return counts;
+}
+
+EventSink& AnimalStore::eventSink() const {
+  return *sink_;
+}
+
+void AnimalStore::setEventSink(EventSink& sink) {
+  sink_ = &sink;
+}
+
+uint64_t AnimalStore::version() const {
+  return version_;
+}
+
+size_t AnimalStore::speciesCount(Species species) const {
+  return species_counts_[static_cast<size_t>(species)];
+}
+
+SpeciesMask AnimalStore::speciesMask() const {
+  SpeciesMask mask = 0;
+  for (size_t i = 0; i < SPECIES_COUNT; ++i) {
+    if (species_counts_[i] > 0) {
+      mask |= speciesBit(static_cast<Species>(i));
+    }
+  }
+  return mask;
+}
+
+ExhibitId AnimalStore::getLocation(const Animal& animal) const {
+  if (!contains(animal)) {
+    return {};
+  }
+  return exhibit_[animal.slot_];
+}
+
+void AnimalStore::setLocation(const Animal& animal, ExhibitId exhibit, Habitat habitat) {
+  if (!contains(animal)) {
+    return;
+  }
+  size_t slot = animal.slot_;
+  if (lazy_) {
+    touch(slot);
+  }
+  exhibit_[slot] = exhibit;
+  placement_counts_[static_cast<size_t>(home_[slot])]--;
+  home_[slot] = placementFor(slot, exhibit, habitat);
+  placement_counts_[static_cast<size_t>(home_[slot])]++;
+  version_++;
+}
+
+Placement AnimalStore::placementFor(size_t slot, ExhibitId exhibit, Habitat habitat) const {
+  if (exhibit.isNull()) {
+    return Placement::HOMELESS;
+  }
+  return habitat == speciesHabitat(species_[slot]) ? Placement::PREFERRED_HABITAT
+                                                   : Placement::OTHER_HABITAT;
+}
+
+size_t AnimalStore::placementCount(Placement placement) const {
+  return placement_counts_[static_cast<size_t>(placement)];
+}
+
+ThresholdCounts AnimalStore::thresholdCounts() const {
+  return {static_cast<size_t>(tally_.sick), static_cast<size_t>(tally_.neglected),
+          static_cast<size_t>(tally_.happy)};
+}
+
+// branch-free so the end-of-day recount can vectorize
+uint8_t AnimalStore::thresholdFlags(int health, int hunger, int happiness, int energy) {
+  constexpr int CRITICAL = Animal::CRITICAL_THRESHOLD;
+  constexpr int STARVING = Animal::MAX_STAT - Animal::CRITICAL_THRESHOLD;
+  bool neglected = (health < CRITICAL) | (hunger > STARVING) | (happiness < CRITICAL) |
+                   (energy < CRITICAL);
+  return static_cast<uint8_t>(neglected | ((happiness > 80) << 1) | ((health < SICK_HEALTH) << 2));
+}
+
+uint8_t AnimalStore::thresholdsAt(size_t slot) const {
+  return thresholdFlags(stats_[static_cast<size_t>(AnimalStat::HEALTH)][slot],
+                        stats_[static_cast<size_t>(AnimalStat::HUNGER)][slot],
+                        stats_[static_cast<size_t>(AnimalStat::HAPPINESS)][slot],
+                        stats_[static_cast<size_t>(AnimalStat::ENERGY)][slot]);
+}
+
+void AnimalStore::Tally::add(const Tally& other) {
+  for (size_t stat = 0; stat < ANIMAL_STAT_COUNT; ++stat) {
+    totals[stat] += other.totals[stat];
+  }
+  neglected += other.neglected;
+  happy += other.happy;
+  sick += other.sick;
+  changes += other.changes;
+}
+
+void AnimalStore::countThresholds(Tally& tally, uint8_t flags, int64_t sign) {
+  tally.neglected += sign * ((flags & NEGLECTED) != 0);
+  tally.happy += sign * ((flags & HAPPY) != 0);
+  tally.sick += sign * ((flags & SICK) != 0);
+}
+
+void AnimalStore::setLazyDecay(bool lazy) {
+  if (lazy == lazy_) {
+    return;
+  }
+  if (lazy_) {
+    settleAll();
+  }
+  deaths_ = {};
+  rechecks_ = {};
+  unplanned_.clear();
+  drift_.clear();
+  tally_.changes++;  // a mark can't carry over between the modes
+  lazy_ = lazy;
+  if (lazy_) {
+    // a booking reaches at most PLAN_HORIZON nights past the current one
+    drift_.resize(PLAN_HORIZON + 1);
+    std::ranges::fill(settled_, night_);
+    std::ranges::fill(booked_, night_);
+    for (size_t slot = 0; slot < animals_.size(); ++slot) {
+      plan(slot);
+    }
+  }
+}
+
+bool AnimalStore::isLazyDecay() const {
+  return lazy_;
+}
+
+// one animal's stats as a single kernel lane, in AnimalStat order
+using StatLane = std::array<int, ANIMAL_STAT_COUNT>;
+
+static StatLane statLane(const std::array<std::vector<int>, ANIMAL_STAT_COUNT>& columns,
+                         size_t slot) {
+  StatLane stats;
+  for (size_t stat = 0; stat < ANIMAL_STAT_COUNT; ++stat) {
+    stats[stat] = columns[stat][slot];
+  }
+  return stats;
+}
+
+static uint8_t laneThresholds(const StatLane& stats) {
+  return AnimalStore::thresholdFlags(stats[static_cast<size_t>(AnimalStat::HEALTH)],
+                                     stats[static_cast<size_t>(AnimalStat::HUNGER)],
+                                     stats[static_cast<size_t>(AnimalStat::HAPPINESS)],
+                                     stats[static_cast<size_t>(AnimalStat::ENERGY)]);
+}
+
+static void runNight(StatLane& stats, const Species& species, const Placement& placement) {
+  runNightlyKernel({&stats[static_cast<size_t>(AnimalStat::HEALTH)],
+                    &stats[static_cast<size_t>(AnimalStat::HUNGER)],
+                    &stats[static_cast<size_t>(AnimalStat::HAPPINESS)],
+                    &stats[static_cast<size_t>(AnimalStat::ENERGY)], &species, &placement, 1},
+                   KernelIsa::SCALAR);
+}
+
+void AnimalStore::settle(size_t slot) const {
+  uint32_t behind = night_ - settled_[slot];
+  if (behind == 0) {
+    return;
+  }
+
+  // the running sums already include these nights, they were booked ahead
+  StatLane stats = statLane(stats_, slot);
+  for (uint32_t night = 0; night < behind; ++night) {
+    StatLane before = stats;
+    runNight(stats, species_[slot], home_[slot]);
+    if (stats == before) {
+      break;  // a fixed point, the nights left change nothing
+    }
+  }
+  for (size_t stat = 0; stat < ANIMAL_STAT_COUNT; ++stat) {
+    stats_[stat][slot] = stats[stat];
+  }
+  settled_[slot] = night_;
+}
+
+void AnimalStore::settleAll() const {
+  for (size_t slot = 0; slot < animals_.size(); ++slot) {
+    settle(slot);
+  }
+}
+
+uint32_t AnimalStore::replay(size_t slot, uint32_t nights, int64_t sign, uint32_t& death) const {
+  StatLane stats = statLane(stats_, slot);
+  // the same test as Animal::isAlive
+  death = stats[static_cast<size_t>(AnimalStat::HEALTH)] <= 0 ? 0 : NO_DEATH;
+  for (uint32_t night = 0; night < nights; ++night) {
+    StatLane before = stats;
+    runNight(stats, species_[slot], home_[slot]);
+    if (stats == before) {
+      return night;  // a fixed point, nothing changes from here on
+    }
+
+    Tally& change = drift_[(night_ + night + 1) % drift_.size()];
+    for (size_t stat = 0; stat < ANIMAL_STAT_COUNT; ++stat) {
+      change.totals[stat] += sign * (stats[stat] - before[stat]);
+    }
+    countThresholds(change, laneThresholds(before), -sign);
+    countThresholds(change, laneThresholds(stats), sign);
+    change.changes += sign;
+    if (death == NO_DEATH && stats[static_cast<size_t>(AnimalStat::HEALTH)] <= 0) {
+      death = night + 1;
+    }
+  }
+  return nights;
+}
+
+void AnimalStore::plan(size_t slot) const {
+  // stale entries pile up as stats change, drop them once they outnumber the animals
+  auto prune = [&](auto& queue) {
+    if (queue.size() <= 2 * animals_.size() + 64) {
+      return;
+    }
+    std::vector<DeathEntry> live;
+    for (; !queue.empty(); queue.pop()) {
+      const DeathEntry& entry = queue.top();
+      if (ids_.contains(entry.id) && stamp_[ids_.denseIndex(entry.id)] == entry.stamp) {
+        live.push_back(entry);
+      }
+    }
+    queue = std::remove_reference_t<decltype(queue)>(std::greater<>(), std::move(live));
+  };
+  prune(deaths_);
+  prune(rechecks_);
+
+  uint32_t stamp = ++stamp_[slot];
+  AnimalId id = ids_.idAt(slot);
+  uint32_t death;
+  uint32_t nights = replay(slot, PLAN_HORIZON, 1, death);
+  booked_[slot] = night_ + nights;
+  if (death != NO_DEATH) {
+    deaths_.push({night_ + death, id, stamp});
+  }
+  if (nights == PLAN_HORIZON) {
+    rechecks_.push({night_ + PLAN_HORIZON, id, stamp});  // still moving, book more then
+  }
+}
+
+void AnimalStore::unplan(size_t slot) const {
+  uint32_t death;
+  replay(slot, booked_[slot] - night_, -1, death);
+  booked_[slot] = night_;
+}
+
+// a slot's actions can write several stats in a row, so it's booked again once at the next
+// night instead of after every write
+void AnimalStore::touch(size_t slot) const {
+  settle(slot);
+  if (booked_[slot] != UNBOOKED) {
+    unplan(slot);
+    booked_[slot] = UNBOOKED;
+    unplanned_.push_back(ids_.idAt(slot));
+  }
+}
+
+void AnimalStore::planTouched() const {
+  for (AnimalId id : unplanned_) {
+    // unless it's been removed since
+    if (ids_.contains(id) && booked_[ids_.denseIndex(id)] == UNBOOKED) {
+      plan(ids_.denseIndex(id));
+    }
+  }
+  unplanned_.clear();
+}
+
+void AnimalStore::updateEndOfDay(const std::vector<Habitat>& exhibit_habitats, size_t workers) {
+  static_assert(KERNEL_MIN_STAT == Animal::MIN_STAT && KERNEL_MAX_STAT == Animal::MAX_STAT,
+                "nightly kernel clamps to the animal stat range");
+
+  if (lazy_) {
+    planTouched();
+    night_++;
+    Tally& change = drift_[night_ % drift_.size()];
+    tally_.add(change);
+    change = {};
+
+    while (!rechecks_.empty() && rechecks_.top().night <= night_) {
+      DeathEntry entry = rechecks_.top();
+      rechecks_.pop();
+      if (ids_.contains(entry.id) && stamp_[ids_.denseIndex(entry.id)] == entry.stamp) {
+        size_t slot = ids_.denseIndex(entry.id);
+        settle(slot);
+        plan(slot);
+      }
+    }
+    version_++;
+    return;
+  }
+
+  int* health = stats_[static_cast<size_t>(AnimalStat::HEALTH)].data();
+  int* hunger = stats_[static_cast<size_t>(AnimalStat::HUNGER)].data();
+  int* happiness = stats_[static_cast<size_t>(AnimalStat::HAPPINESS)].data();
+  int* energy = stats_[static_cast<size_t>(AnimalStat::ENERGY)].data();
+
+  size_t count = animals_.size();
+  size_t chunks = chunkCount(count);
+  placement_.resize(count);
+  chunk_tallies_.assign(chunks, {});
+
+  // every chunk touches only its own slots and its own tally
+  forEachChunk(chunks, workers, [&](size_t chunk) {
+    size_t begin = chunk * SWEEP_CHUNK;
+    size_t end = std::min(begin + SWEEP_CHUNK, count);
+
+    // resolve each slot's exhibit once so the kernel only sees packed byte columns
+    for (size_t i = begin; i < end; ++i) {
+      ExhibitId exhibit = exhibit_[i];
+      if (exhibit.isNull()) {
+        placement_[i] = Placement::HOMELESS;
+      } else if (exhibit_habitats[exhibit.index] == speciesHabitat(species_[i])) {
+        placement_[i] = Placement::PREFERRED_HABITAT;
+      } else {
+        placement_[i] = Placement::OTHER_HABITAT;
+      }
+    }
+
+    runNightlyKernel({health + begin, hunger + begin, happiness + begin, energy + begin,
+                      species_.data() + begin, placement_.data() + begin, end - begin});
+
+    Tally& tally = chunk_tallies_[chunk];
+    for (size_t i = begin; i < end; ++i) {
+      tally.totals[static_cast<size_t>(AnimalStat::HEALTH)] += health[i];
+      tally.totals[static_cast<size_t>(AnimalStat::HUNGER)] += hunger[i];
+      tally.totals[static_cast<size_t>(AnimalStat::HAPPINESS)] += happiness[i];
+      tally.totals[static_cast<size_t>(AnimalStat::ENERGY)] += energy[i];
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+      uint8_t flags = thresholdFlags(health[i], hunger[i], happiness[i], energy[i]);
+      tally.neglected += flags & NEGLECTED;
+      tally.happy += (flags >> 1) & 1;
+      tally.sick += flags >> 2;
+    }
+  });
+
+  // reduce in chunk order
+  Tally tally;
+  for (const Tally& chunk : chunk_tallies_) {
+    tally.add(chunk);
+  }
+  tally.changes = tally_.changes;  // eager marks compare the columns instead
+  tally_ = tally;
+  version_++;
+}
+
+std::vector<AnimalId> AnimalStore::deadAnimals(size_t workers) const {
+  if (lazy_) {
+    planTouched();
+    std::vector<DeathEntry> due;
+    for (; !deaths_.empty() && deaths_.top().night <= night_; deaths_.pop()) {
+      const DeathEntry& entry = deaths_.top();
+      if (ids_.contains(entry.id) && stamp_[ids_.denseIndex(entry.id)] == entry.stamp) {
+        due.push_back(entry);
+      }
+    }
+
+    std::vector<std::pair<size_t, AnimalId>> dead;
+    for (const DeathEntry& entry : due) {
+      size_t slot = ids_.denseIndex(entry.id);
+      settle(slot);
+      if (stats_[static_cast<size_t>(AnimalStat::HEALTH)][slot] <= 0) {
+        dead.push_back({slot, entry.id});
+        deaths_.push(entry);  // still dead until it's removed
+      } else {
+        unplan(slot);
+        plan(slot);
+      }
+    }
+
+    // slot order, like the eager sweep
+    std::ranges::sort(dead);
+    std::vector<AnimalId> ids;
+    for (const auto& [slot, id] : dead) {
+      ids.push_back(id);
+    }
+    return ids;
+  }
+
+  const int* health = stats_[static_cast<size_t>(AnimalStat::HEALTH)].data();
+  size_t count = animals_.size();
+  size_t chunks = chunkCount(count);
+
+  std::vector<std::vector<AnimalId>> chunk_dead(chunks);
+  forEachChunk(chunks, workers, [&](size_t chunk) {
+    size_t begin = chunk * SWEEP_CHUNK;
+    size_t end = std::min(begin + SWEEP_CHUNK, count);
+    for (size_t i = begin; i < end; ++i) {
+      // the same test as Animal::isAlive
+      if (health[i] <= 0) {
+        chunk_dead[chunk].push_back(ids_.idAt(i));
+      }
+    }
+  });
+
+  // concatenate in chunk order so the ids come out in slot order
+  std::vector<AnimalId> dead;
+  for (const auto& ids : chunk_dead) {
+    dead.insert(dead.end(), ids.begin(), ids.end());
+  }
+  return dead;
+}
@@ -1,24 +1,5 @@
 #include "bear.h"
 
-#include <iostream>
 #include <utility>
 
-Bear::Bear(std::string name, int age) : Animal(std::move(name), "Bear", age) {
-  purchase_cost_ = 800.0;
-  feeding_cost_ = 40.0;
-  maintenance_cost_ = 60.0;
-}
-
-void Bear::makeSound() const {
-  std::cout << getName() << " the Bear is growling!\n";
-}
-
-void Bear::updateStatsEndOfDay() {
-  updateHunger(9);
-  updateHappiness(-8);
-  updateEnergy(-6);
-}
-
-std::string Bear::getPreferredHabitat() const {
-  return "Forest";
-}
+Bear::Bear(std::string name, int age) : Animal(std::move(name), Species::BEAR, age) {}
@@ -0,0 +1,294 @@
+#include "campaign.h"
+
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+
+#include "command_script.h"
+
+enum class ParamKind : uint8_t {
+  NONE,
+  INT,    // int_param
+  FLOAT,  // float_param
+};
+
+struct MissionTypeSpec {
+  std::string_view name;
+  ParamKind param;
+};
+
+// indexed by MissionType
+static constexpr std::array<MissionTypeSpec, MISSION_TYPE_COUNT> MISSION_TYPES = {{
+    {"add_animal_to_exhibit", ParamKind::NONE},
+    {"own_x_animals", ParamKind::INT},
+    {"own_x_species", ParamKind::INT},
+    {"own_x_exhibits", ParamKind::INT},
+    {"feed_x_animals", ParamKind::INT},
+    {"play_with_animal", ParamKind::NONE},
+    {"exercise_animal", ParamKind::NONE},
+    {"no_animals_need_attention", ParamKind::NONE},
+    {"no_sick_animals", ParamKind::NONE},
+    {"no_homeless_animals", ParamKind::NONE},
+    {"preferred_habitats", ParamKind::NONE},
+    {"clean_x_exhibits", ParamKind::INT},
+    {"exhibits_cleanliness_at_least_x", ParamKind::INT},
+    {"balance_at_least", ParamKind::FLOAT},
+    {"zoo_rating_above", ParamKind::FLOAT},
+    {"attract_x_visitors", ParamKind::INT},
+    {"own_elephant", ParamKind::NONE},
+    {"own_medium_animal", ParamKind::NONE},
+    {"own_special_animal", ParamKind::NONE},
+}};
+
+static constexpr std::string_view STANDARD_CAMPAIGN = R"(
+day 1
+required "Purchase your first animal" own_x_animals 1
+required "Purchase your first exhibit" own_x_exhibits 1
+required "Add your animal to the exhibit" add_animal_to_exhibit
+optional "End day with balance of $1200+" balance_at_least 1200 reward 100 end_of_day
+
+day 2
+required "Own 2 different species" own_x_species 2
+required "Feed an animal" feed_x_animals 1
+required "End day with no homeless animals" no_homeless_animals end_of_day
+optional "End day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 100 end_of_day
+
+day 3
+required "Own 3 different species" own_x_species 3
+required "Own 2 exhibits" own_x_exhibits 2
+required "Feed 2 animals" feed_x_animals 2
+optional "Clean an exhibit" clean_x_exhibits 1 reward 100
+
+day 4
+required "Play with an animal" play_with_animal
+required "Feed all animals" feed_x_animals all
+required "All exhibits at 80+ cleanliness" exhibits_cleanliness_at_least_x 80 end_of_day
+required "All animals in preferred habitats" preferred_habitats end_of_day
+optional "End day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 100 end_of_day
+
+day 5
+required "Own 4 different species" own_x_species 4
+required "Own a penguin or monkey" own_medium_animal
+required "No homeless animals" no_homeless_animals end_of_day
+optional "End day with balance of $800+" balance_at_least 800 reward 100 end_of_day
+optional "End day with 40+ visitors" attract_x_visitors 40 reward 200 end_of_day
+
+day 6
+required "Exercise an animal" exercise_animal
+required "Feed all animals" feed_x_animals all
+required "All exhibits at 80+ cleanliness" exhibits_cleanliness_at_least_x 80 end_of_day
+optional "End the day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 100 end_of_day
+optional "Own 5 animals" own_x_animals 5 reward 100
+
+day 7
+required "Own 3 exhibits" own_x_exhibits 3
+required "No animals need attention" no_animals_need_attention end_of_day
+optional "End day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 200 end_of_day
+optional "End day with balance of $1500+" balance_at_least 1000 reward 100 end_of_day
+optional "All animals in preferred habitats" preferred_habitats reward 200 end_of_day
+
+day 8
+required "Own 5 different species" own_x_species 5
+required "Feed all animals" feed_x_animals all
+optional "End day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 200 end_of_day
+optional "End day with balance of $1500+" balance_at_least 1500 reward 150 end_of_day
+optional "Own a bear or lion" own_special_animal reward 250
+
+day 9
+required "Own 6 different species" own_x_species 6
+required "No animals need attention" no_animals_need_attention end_of_day
+required "All exhibits at 80+ cleanliness" exhibits_cleanliness_at_least_x 80 end_of_day
+optional "End day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 200 end_of_day
+optional "End day with 60+ visitors" attract_x_visitors 60 reward 250 end_of_day
+
+day 10
+required "No homeless animals" no_homeless_animals
+required "All animals are in preferred habitats" preferred_habitats end_of_day
+required "No sick animals" no_sick_animals end_of_day
+required "No animals need attention" no_animals_need_attention end_of_day
+optional "Own 7 different species" own_x_species 7 reward 250
+optional "Own an elephant" own_elephant reward 200
+optional "End day with zoo rating of 4.0+" zoo_rating_above 4.0 reward 200 end_of_day
+optional "Balance above $2000" balance_at_least 2000 reward 200 end_of_day
+)";
+
+template <typename T>
+static bool parseNumber(std::string_view word, T& value) {
+  auto result = std::from_chars(word.data(), word.data() + word.size(), value);
+  return result.ec == std::errc() && result.ptr == word.data() + word.size();
+}
+
+bool Campaign::load(std::string_view text, std::string& error) {
+  missions_.clear();
+  day_starts_.clear();
+  predicates_.clear();
+
+  std::vector<std::string_view> tokens;
+  std::string_view line;
+  int line_number = 0;
+  while (nextScriptLine(text, line)) {
+    ++line_number;
+    tokens.clear();
+    ScriptTokenizer tokenizer(line);
+    std::string_view token;
+    while (tokenizer.next(token)) {
+      tokens.push_back(token);
+    }
+    if (tokens.empty()) {
+      continue;
+    }
+
+    std::string message;
+    if (!parseLine(tokens, message)) {
+      error = "line " + std::to_string(line_number) + ": " + message;
+      missions_.clear();
+      day_starts_.clear();
+      predicates_.clear();
+      return false;
+    }
+  }
+
+  if (day_starts_.empty()) {
+    error = "the campaign has no days";
+    return false;
+  }
+  return true;
+}
+
+bool Campaign::loadFile(const std::string& path, std::string& error) {
+  std::ifstream file(path);
+  if (!file) {
+    error = "cannot open " + path;
+    return false;
+  }
+  std::ostringstream text;
+  text << file.rdbuf();
+  if (!load(text.str(), error)) {
+    error = path + ": " + error;
+    return false;
+  }
+  return true;
+}
+
+bool Campaign::parseLine(std::span<const std::string_view> tokens, std::string& error) {
+  if (scriptWordEquals(tokens[0], "day")) {
+    int day = 0;
+    if (tokens.size() != 2 || !parseNumber(tokens[1], day)) {
+      error = "expected \"day <number>\"";
+      return false;
+    }
+    if (day != getDayCount() + 1) {
+      error = "expected day " + std::to_string(getDayCount() + 1);
+      return false;
+    }
+    day_starts_.push_back(missions_.size());
+    return true;
+  }
+
+  MissionSpec spec;
+  if (scriptWordEquals(tokens[0], "optional")) {
+    spec.required = false;
+  } else if (!scriptWordEquals(tokens[0], "required")) {
+    error = "expected \"day\", \"required\" or \"optional\"";
+    return false;
+  }
+  if (day_starts_.empty()) {
+    error = "missions must follow a day";
+    return false;
+  }
+  if (tokens.size() < 3) {
+    error = "expected a description and a mission type";
+    return false;
+  }
+  spec.description = tokens[1];
+
+  size_t type = 0;
+  while (type < MISSION_TYPE_COUNT && !scriptWordEquals(MISSION_TYPES[type].name, tokens[2])) {
+    ++type;
+  }
+  if (type == MISSION_TYPE_COUNT) {
+    error = "unknown mission type \"" + std::string(tokens[2]) + "\"";
+    return false;
+  }
+  spec.type = static_cast<MissionType>(type);
+
+  size_t next = 3;
+  ParamKind param = MISSION_TYPES[type].param;
+  if (param != ParamKind::NONE) {
+    if (next == tokens.size()) {
+      error = std::string(MISSION_TYPES[type].name) + " needs a parameter";
+      return false;
+    }
+    std::string_view word = tokens[next++];
+    bool parsed = param == ParamKind::FLOAT ? parseNumber(word, spec.float_param)
+                                            : parseNumber(word, spec.int_param);
+    if (param == ParamKind::INT && scriptWordEquals(word, "all")) {
+      spec.all_animals = true;
+      parsed = true;
+    }
+    if (!parsed) {
+      error = "bad parameter \"" + std::string(word) + "\"";
+      return false;
+    }
+  }
+
+  while (next < tokens.size()) {
+    std::string_view word = tokens[next++];
+    if (scriptWordEquals(word, "end_of_day")) {
+      spec.end_of_day = true;
+    } else if (scriptWordEquals(word, "reward")) {
+      if (next == tokens.size() || !parseNumber(tokens[next++], spec.reward)) {
+        error = "expected \"reward <number>\"";
+        return false;
+      }
+    } else if (scriptWordEquals(word, "when")) {
+      PredicateProgram program;
+      if (!compilePredicate(tokens.subspan(next), program, error)) {
+        return false;
+      }
+      spec.predicate = predicates_.size();
+      predicates_.push_back(std::move(program));
+      next = tokens.size();
+    } else {
+      error = "unexpected \"" + std::string(word) + "\"";
+      return false;
+    }
+  }
+
+  missions_.push_back(std::move(spec));
+  return true;
+}
+
+int Campaign::getDayCount() const {
+  return static_cast<int>(day_starts_.size());
+}
+
+std::span<const MissionSpec> Campaign::missionsFor(int day) const {
+  if (day < 1 || day > getDayCount()) {
+    return {};
+  }
+  size_t begin = day_starts_[day - 1];
+  size_t end = day == getDayCount() ? missions_.size() : day_starts_[day];
+  return std::span(missions_).subspan(begin, end - begin);
+}
+
+const PredicateProgram* Campaign::predicateFor(const MissionSpec& spec) const {
+  return spec.predicate == MissionSpec::NO_PREDICATE ? nullptr : &predicates_[spec.predicate];
+}
+
+const Campaign& standardCampaign() {
+  static const Campaign campaign = [] {
+    Campaign standard;
+    std::string error;
+    [[maybe_unused]] bool ok = standard.load(STANDARD_CAMPAIGN, error);
+    assert(ok);
+    return standard;
+  }();
+  return campaign;
+}
+
+std::string_view missionTypeName(MissionType type) {
+  return MISSION_TYPES[static_cast<size_t>(type)].name;
+}
@@ -0,0 +1,150 @@
+#include "command_script.h"
+
+struct VerbSpec {
+  std::string_view name;
+  ScriptVerb verb;
+  size_t arg_count;
+};
+
+static constexpr std::array<VerbSpec, 14> VERBS = {{
+    {"buy", ScriptVerb::BUY, 2},
+    {"build", ScriptVerb::BUILD, 2},
+    {"sell", ScriptVerb::SELL, 1},
+    {"demolish", ScriptVerb::DEMOLISH, 1},
+    {"place", ScriptVerb::PLACE, 2},
+    {"remove", ScriptVerb::REMOVE, 1},
+    {"feed", ScriptVerb::FEED, 1},
+    {"play", ScriptVerb::PLAY, 1},
+    {"exercise", ScriptVerb::EXERCISE, 1},
+    {"treat", ScriptVerb::TREAT, 1},
+    {"clean", ScriptVerb::CLEAN, 1},
+    {"missions", ScriptVerb::MISSIONS, 0},
+    {"end", ScriptVerb::END, 0},
+    {"quit", ScriptVerb::QUIT, 0},
+}};
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static char lowerAscii(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+ScriptTokenizer::ScriptTokenizer(std::string_view line) : rest_(line) {}
+
+bool ScriptTokenizer::next(std::string_view& token) {
+  size_t start = 0;
+  while (start < rest_.size() && isSpace(rest_[start])) {
+    ++start;
+  }
+  if (start == rest_.size() || rest_[start] == '#') {
+    rest_ = {};
+    return false;
+  }
+
+  if (rest_[start] == '"') {
+    // an unterminated quote runs to the end of the line
+    size_t close = rest_.find('"', start + 1);
+    size_t end = close == std::string_view::npos ? rest_.size() : close;
+    token = rest_.substr(start + 1, end - start - 1);
+    rest_ = close == std::string_view::npos ? std::string_view{} : rest_.substr(close + 1);
+    return true;
+  }
+
+  size_t end = start;
+  while (end < rest_.size() && !isSpace(rest_[end]) && rest_[end] != '#') {
+    ++end;
+  }
+  token = rest_.substr(start, end - start);
+  rest_ = rest_.substr(end);
+  return true;
+}
+
+bool nextScriptLine(std::string_view& script, std::string_view& line) {
+  if (script.empty()) {
+    return false;
+  }
+  size_t end = script.find('\n');
+  if (end == std::string_view::npos) {
+    line = script;
+    script = {};
+  } else {
+    line = script.substr(0, end);
+    script = script.substr(end + 1);
+  }
+  return true;
+}
+
+ScriptCommand parseScriptCommand(std::string_view line) {
+  ScriptCommand command;
+  ScriptTokenizer tokens(line);
+  std::string_view word;
+  if (!tokens.next(word)) {
+    return command;
+  }
+
+  command.verb = ScriptVerb::INVALID;
+  const VerbSpec* spec = nullptr;
+  for (const VerbSpec& candidate : VERBS) {
+    if (scriptWordEquals(candidate.name, word)) {
+      spec = &candidate;
+      break;
+    }
+  }
+  if (!spec) {
+    return command;
+  }
+
+  std::string_view arg;
+  while (tokens.next(arg)) {
+    if (command.arg_count == spec->arg_count) {
+      return command;
+    }
+    command.args[command.arg_count++] = arg;
+  }
+  if (command.arg_count == spec->arg_count) {
+    command.verb = spec->verb;
+  }
+  return command;
+}
+
+std::string_view scriptVerbName(ScriptVerb verb) {
+  for (const VerbSpec& spec : VERBS) {
+    if (spec.verb == verb) {
+      return spec.name;
+    }
+  }
+  return verb == ScriptVerb::NONE ? "none" : "invalid";
+}
+
+bool scriptWordEquals(std::string_view a, std::string_view b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (lowerAscii(a[i]) != lowerAscii(b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::optional<Species> speciesFromScript(std::string_view word) {
+  for (size_t i = 0; i < SPECIES_COUNT; ++i) {
+    if (scriptWordEquals(SPECIES_TRAITS[i].name, word)) {
+      return static_cast<Species>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+Habitat habitatFromScript(std::string_view word) {
+  for (Habitat habitat : {Habitat::GRASSLAND, Habitat::FOREST, Habitat::JUNGLE, Habitat::SAVANNA,
+                          Habitat::ARCTIC}) {
+    if (scriptWordEquals(habitatName(habitat), word)) {
+      return habitat;
+    }
+  }
+  return Habitat::UNKNOWN;
+}
@@ -0,0 +1,133 @@
+#include "event_sink.h"
+
+#include <iostream>
+
+ConsoleEventSink::ConsoleEventSink(std::ostream& out) : out_(out) {}
+
+void ConsoleEventSink::emit(const ZooEvent& e) {
+  switch (e.type) {
+    case EventType::FOOD_REFUSED:
+      out_ << e.subject << " needs a positive amount of food!\n";
+      break;
+    case EventType::ANIMAL_ATE:
+      out_ << e.subject << " the " << e.species << " is eating.\n";
+      break;
+
+    case EventType::NULL_ANIMAL:
+      out_ << "Cannot add null animal!\n";
+      break;
+    case EventType::ALREADY_IN_THIS_EXHIBIT:
+      out_ << e.subject << " is already in this exhibit!\n";
+      break;
+    case EventType::EXHIBIT_AT_CAPACITY:
+      out_ << "Exhibit " << e.place << " is at full capacity!\n";
+      break;
+    case EventType::ANIMAL_ADDED:
+      out_ << "Added " << e.subject << " to Exhibit " << e.place << "!\n";
+      break;
+    case EventType::NOT_IN_THIS_EXHIBIT:
+      out_ << "Animal not found in this exhibit!\n";
+      break;
+    case EventType::ANIMAL_REMOVED:
+      out_ << "Removed " << e.subject << " from Exhibit " << e.place << "!\n";
+      break;
+    case EventType::EXHIBIT_CLEANED:
+      out_ << "Exhibit " << e.place << " has been cleaned!\n";
+      break;
+
+    case EventType::ANIMAL_UNAFFORDABLE:
+      out_ << "Insufficient funds, cannot purchase animal.\n";
+      break;
+    case EventType::ANIMAL_PURCHASED:
+      out_ << "Purchased " << e.subject << " the " << e.species << " for $" << e.amount << ".\n";
+      break;
+    case EventType::SOLD_ANIMAL_NOT_IN_ZOO:
+      out_ << "Animal not found in zoo!\n";
+      break;
+    case EventType::ANIMAL_SOLD:
+      out_ << "Sold " << e.subject << " the " << e.species << " for $" << e.amount << "!\n";
+      break;
+    case EventType::EXHIBIT_UNAFFORDABLE:
+      out_ << "Insufficient funds, cannot purchase exhibit.\n";
+      break;
+    case EventType::EXHIBIT_PURCHASED:
+      out_ << "Purchased Exhibit " << e.place << " for $" << e.amount << ".\n";
+      break;
+    case EventType::EXHIBIT_NOT_IN_ZOO:
+      out_ << "Exhibit not found in zoo.\n";
+      break;
+    case EventType::EXHIBIT_SOLD:
+      out_ << "Sold " << e.place << " for $" << e.amount << "!\n";
+      break;
+    case EventType::ANIMAL_NOT_IN_ZOO:
+      out_ << "Animal not found in zoo.\n";
+      break;
+    case EventType::ALREADY_IN_EXHIBIT:
+      out_ << e.subject << " is already in exhibit " << e.place << ".\n";
+      break;
+    case EventType::PLACEMENT_FAILED:
+      out_ << "Failed to add animal to exhibit.\n";
+      break;
+    case EventType::MOVED_ANIMAL_HOMELESS:
+      out_ << "Animal not found in any exhibit! Need to add animal to an exhibit before moving!\n";
+      break;
+    case EventType::MOVE_TARGET_FULL:
+      out_ << "Exhibit is full!\n";
+      break;
+    case EventType::ANIMAL_MOVED:
+      out_ << "Moved " << e.subject << " to " << e.place << ".\n";
+      break;
+    case EventType::ANIMAL_DIED:
+      out_ << e.subject << " the " << e.species << " has died.\n";
+      break;
+
+    case EventType::ANIMAL_MISSING:
+      out_ << "Animal does not exist!\n";
+      break;
+    case EventType::ANIMAL_NOT_ALIVE:
+      out_ << "Animal is not alive.\n";
+      break;
+    case EventType::FEEDING_UNAFFORDABLE:
+      out_ << "Not enough money to feed " << e.subject << " the " << e.species << ".\n";
+      break;
+    case EventType::ANIMAL_FED:
+      out_ << e.actor << " fed " << e.subject << " the " << e.species << " for $" << e.amount
+           << ".\n";
+      break;
+    case EventType::TOO_TIRED_TO_PLAY:
+      out_ << e.subject << " the " << e.species << " is too tired to play.\n";
+      break;
+    case EventType::ANIMAL_PLAYED:
+      out_ << e.actor << " played with " << e.subject << " the " << e.species << ".\n";
+      break;
+    case EventType::TOO_TIRED_TO_EXERCISE:
+      out_ << e.subject << " the " << e.species << " is too tired to exercise.\n";
+      break;
+    case EventType::ANIMAL_EXERCISED:
+      out_ << e.actor << " exercised " << e.subject << " the " << e.species << ".\n";
+      break;
+    case EventType::TREATMENT_UNAFFORDABLE:
+      out_ << "Not enough money to treat " << e.subject << " the " << e.species << "!\n";
+      break;
+    case EventType::ANIMAL_TREATED:
+      // the treatment fee has always been printed as a whole number
+      out_ << e.actor << " gave medical care to " << e.subject << " the " << e.species << " for $"
+           << static_cast<long long>(e.amount) << ".\n";
+      break;
+    case EventType::EXHIBIT_MISSING:
+      out_ << "Exhibit does not exist.\n";
+      break;
+    case EventType::PLAYER_CLEANED_EXHIBIT:
+      out_ << e.actor << " cleaned " << e.place << ".\n";
+      break;
+
+    case EventType::MISSION_COMPLETED:
+      out_ << "\nMission Complete: " << e.subject << "\n";
+      break;
+  }
+}
+
+EventSink& consoleEventSink() {
+  static ConsoleEventSink sink(std::cout);
+  return sink;
+}
@@ -1,40 +1,48 @@
 #include "exhibit.h"
 
 #include <algorithm>
-#include <iostream>
 #include <utility>
 
 Exhibit::Exhibit(std::string name, std::string type, int capacity, double purchase_cost,
                  double maintenance_cost)
     : name_(std::move(name)),
       type_(std::move(type)),
+      habitat_(habitatFromName(type_)),
       capacity_(capacity),
       cleanliness_(100),
       purchase_cost_(purchase_cost),
       maintenance_cost_(maintenance_cost) {}
 
+void* Exhibit::operator new(size_t size) {
+  return poolAllocate(size);
+}
+
+void Exhibit::operator delete(void* ptr, size_t size) noexcept {
+  poolDeallocate(ptr, size);
+}
+
 bool Exhibit::canAddAnimal() const {
   return static_cast<int>(animals_.size()) < capacity_;
 }
 
 bool Exhibit::addAnimal(Animal* animal) {
   if (!animal) {
-    std::cout << "Cannot add null animal!\n";
+    sink_->emit({.type = EventType::NULL_ANIMAL});
     return false;
   }
 
   if (containsAnimal(animal)) {
-    std::cout << animal->getName() << " is already in this exhibit!\n";
+    sink_->emit({.type = EventType::ALREADY_IN_THIS_EXHIBIT, .subject = animal->getName()});
     return false;
   }
 
   if (!canAddAnimal()) {
-    std::cout << "Exhibit " << name_ << " is at full capacity!\n";
+    sink_->emit({.type = EventType::EXHIBIT_AT_CAPACITY, .place = name_});
     return false;
   }
 
   animals_.push_back(animal);
-  std::cout << "Added " << animal->getName() << " to Exhibit " << name_ << "!\n";
+  sink_->emit({.type = EventType::ANIMAL_ADDED, .subject = animal->getName(), .place = name_});
   return true;
 }
 
@@ -46,11 +54,11 @@ bool Exhibit::removeAnimal(Animal* animal) {
   auto it = std::find(animals_.begin(), animals_.end(), animal);
 
   if (it == animals_.end()) {
-    std::cout << "Animal not found in this exhibit!\n";
+    sink_->emit({.type = EventType::NOT_IN_THIS_EXHIBIT});
     return false;
   }
 
-  std::cout << "Removed " << (*it)->getName() << " from Exhibit " << name_ << "!\n";
+  sink_->emit({.type = EventType::ANIMAL_REMOVED, .subject = (*it)->getName(), .place = name_});
   animals_.erase(it);
   return true;
 }
@@ -71,6 +79,14 @@ std::vector<Animal*> Exhibit::getAllAnimals() {
   return animals_;
 }
 
+std::span<Animal* const> Exhibit::animalView() const {
+  return animals_;
+}
+
+ExhibitId Exhibit::getId() const {
+  return id_;
+}
+
 const std::string& Exhibit::getName() const {
   return name_;
 }
@@ -79,6 +95,10 @@ const std::string& Exhibit::getType() const {
   return type_;
 }
 
+Habitat Exhibit::getHabitat() const {
+  return habitat_;
+}
+
 int Exhibit::getMaxCapacity() const {
   return capacity_;
 }
@@ -99,25 +119,38 @@ double Exhibit::getMaintenanceCost() const {
   return maintenance_cost_;
 }
 
-bool Exhibit::needsCleaning() {
+bool Exhibit::needsCleaning() const {
   return cleanliness_ < 50;
 }
 
 void Exhibit::updateCleanliness(int delta) {
-  cleanliness_ += delta;
-  if (cleanliness_ > 100) {
-    cleanliness_ = 100;
+  int cleanliness = cleanliness_ + delta;
+  if (cleanliness > 100) {
+    cleanliness = 100;
   }
-  if (cleanliness_ < 0) {
-    cleanliness_ = 0;
+  if (cleanliness < 0) {
+    cleanliness = 0;
   }
+  setCleanliness(cleanliness);
 }
 
 void Exhibit::clean() {
-  cleanliness_ = 100;
-  std::cout << "Exhibit " << name_ << " has been cleaned!\n";
+  setCleanliness(100);
+  sink_->emit({.type = EventType::EXHIBIT_CLEANED, .place = name_});
 }
 
 void Exhibit::setName(const std::string& name) {
   name_ = name;
 }
+
+void Exhibit::setCleanliness(int cleanliness) {
+  if (totals_) {
+    totals_->cleanliness += cleanliness - cleanliness_;
+    totals_->dirty += (cleanliness < 50);
+    totals_->dirty -= (cleanliness_ < 50);
+    totals_->by_cleanliness[cleanliness_]--;
+    totals_->by_cleanliness[cleanliness]++;
+    totals_->version++;
+  }
+  cleanliness_ = cleanliness;
+}
@@ -1,15 +1,17 @@
 #include "game.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <limits>
-#include <random>
 #include <set>
 #include <sstream>
 #include <utility>
 
 #include "animal.h"
 #include "bear.h"
+#include "command_script.h"
 #include "elephant.h"
 #include "lion.h"
 #include "monkey.h"
@@ -17,23 +19,55 @@
 #include "rabbit.h"
 #include "tortoise.h"
 
-Game::Game(const Player& player, std::string zoo_name)
+struct AgeRange {
+  int min;
+  int max;
+};
+
+// ages a newly bought animal can have, indexed by Species
+static constexpr std::array<AgeRange, SPECIES_COUNT> SPECIES_AGES = {{
+    {4, 20},   // lion
+    {3, 25},   // bear
+    {10, 60},  // elephant
+    {3, 15},   // monkey
+    {5, 20},   // penguin
+    {1, 8},    // rabbit
+    {10, 50},  // tortoise
+}};
+
+// the order the purchase menus list them in
+static constexpr std::array<Species, SPECIES_COUNT> MENU_SPECIES = {
+    Species::RABBIT, Species::TORTOISE, Species::PENGUIN, Species::MONKEY,
+    Species::BEAR,   Species::LION,     Species::ELEPHANT,
+};
+static constexpr std::array<Habitat, 5> MENU_HABITATS = {
+    Habitat::GRASSLAND, Habitat::FOREST, Habitat::JUNGLE, Habitat::SAVANNA, Habitat::ARCTIC,
+};
+
+Game::Game(const Player& player, std::string zoo_name, uint64_t seed, std::ostream& out)
     : player_(player),
-      zoo_(zoo_name, 2000.0),
+      zoo_(zoo_name, 2000.0, seed),
+      out_(out),
+      screen_(out_),
       mission_system_(zoo_),
       running_(true),
+      seed_(seed),
       action_points_(3),
       max_action_points_(3) {}
 
-void Game::start() {
-  std::cout << "\nWelcome to Zooperator " << player_.getName() << "!\n";
-  std::cout << "You'll be working as the zookeeper for: " << zoo_.getName() << ".\n\n";
-  std::cout << "Goals\n";
-  std::cout << " - Keep the zoo running for 10 days.\n";
-  std::cout << " - Complete all the required missions each day.\n";
-  std::cout << " - Keep all animals happy and healthy.\n";
+void Game::displayWelcome() {
+  out_ << "\nWelcome to Zooperator " << player_.getName() << "!\n";
+  out_ << "You'll be working as the zookeeper for: " << zoo_.getName() << ".\n\n";
+  out_ << "Goals\n";
+  out_ << " - Keep the zoo running for " << mission_system_.getDayCount() << " days.\n";
+  out_ << " - Complete all the required missions each day.\n";
+  out_ << " - Keep all animals happy and healthy.\n";
+
+  out_ << "\nDAY " << zoo_.getDay() << "\n";
+}
 
-  std::cout << "\nDAY " << zoo_.getDay() << "\n";
+void Game::start() {
+  displayWelcome();
 
   while (running_) {
     displayMainMenu();
@@ -44,7 +78,8 @@ void Game::start() {
         displayHelp();
         break;
       case 2:
-        mission_system_.displayMissions(false);
+        mission_system_.renderMissions(screen_, false);
+        screen_.flush();
         break;
       case 3:
         manageAnimals();
@@ -65,6 +100,184 @@ void Game::start() {
   }
 }
 
+bool Game::runScript(std::istream& script) {
+  // one read, every command and argument below is a view into this buffer
+  const std::string text{std::istreambuf_iterator<char>(script), std::istreambuf_iterator<char>()};
+  std::string_view rest = text;
+  std::string_view line;
+  size_t line_number = 0;
+  bool ok = true;
+
+  displayWelcome();
+  out_ << "Seed: " << seed_ << "\n";
+
+  while (running_ && nextScriptLine(rest, line)) {
+    ok &= runCommand(line, ++line_number);
+  }
+  return ok;
+}
+
+bool Game::runCommand(std::string_view line) {
+  return runCommand(line, 0);
+}
+
+bool Game::runCommand(std::string_view line, size_t line_number) {
+  ScriptCommand command = parseScriptCommand(line);
+  if (command.verb == ScriptVerb::NONE) {
+    return true;
+  }
+  if (command.verb == ScriptVerb::INVALID) {
+    out_ << "Line " << line_number << ": cannot understand \"" << line << "\"\n";
+    return false;
+  }
+
+  out_ << "\n> " << line << "\n";
+
+  // the first argument names an animal for most verbs, build/buy/clean/demolish aside
+  Animal* animal = nullptr;
+  switch (command.verb) {
+    case ScriptVerb::SELL:
+    case ScriptVerb::PLACE:
+    case ScriptVerb::REMOVE:
+    case ScriptVerb::FEED:
+    case ScriptVerb::PLAY:
+    case ScriptVerb::EXERCISE:
+    case ScriptVerb::TREAT:
+      animal = findAnimalByName(command.args[0]);
+      if (!animal) {
+        out_ << "Line " << line_number << ": no animal named " << command.args[0] << "\n";
+        return false;
+      }
+      break;
+    default:
+      break;
+  }
+
+  Exhibit* exhibit = nullptr;
+  if (command.verb == ScriptVerb::PLACE || command.verb == ScriptVerb::CLEAN ||
+      command.verb == ScriptVerb::DEMOLISH) {
+    std::string_view exhibit_name = command.args[command.arg_count - 1];
+    exhibit = findExhibitByName(exhibit_name);
+    if (!exhibit) {
+      out_ << "Line " << line_number << ": no exhibit named " << exhibit_name << "\n";
+      return false;
+    }
+  }
+
+  switch (command.verb) {
+    case ScriptVerb::BUY: {
+      std::optional<Species> species = speciesFromScript(command.args[0]);
+      if (!species) {
+        out_ << "Line " << line_number << ": no species called " << command.args[0] << "\n";
+        return false;
+      }
+      buyAnimal(makeAnimal(*species, std::string(command.args[1])));
+      break;
+    }
+    case ScriptVerb::BUILD: {
+      Habitat habitat = habitatFromScript(command.args[0]);
+      if (habitat == Habitat::UNKNOWN) {
+        out_ << "Line " << line_number << ": no habitat called " << command.args[0] << "\n";
+        return false;
+      }
+      buyExhibit(makeExhibit(habitat, std::string(command.args[1])));
+      break;
+    }
+    case ScriptVerb::SELL:
+      sellAnimal(animal);
+      break;
+    case ScriptVerb::DEMOLISH:
+      sellExhibit(exhibit);
+      break;
+    case ScriptVerb::PLACE:
+      if (zoo_.findAnimalLocation(animal)) {
+        moveAnimalToExhibit(animal, exhibit);
+      } else {
+        addAnimalToExhibit(animal, exhibit);
+      }
+      break;
+    case ScriptVerb::REMOVE:
+      removeAnimalFromExhibit(animal);
+      break;
+    case ScriptVerb::FEED:
+      feedAnimal(animal);
+      break;
+    case ScriptVerb::PLAY:
+      playWithAnimal(animal);
+      break;
+    case ScriptVerb::EXERCISE:
+      exerciseAnimal(animal);
+      break;
+    case ScriptVerb::TREAT:
+      treatAnimal(animal);
+      break;
+    case ScriptVerb::CLEAN:
+      cleanExhibit(exhibit);
+      break;
+    case ScriptVerb::MISSIONS:
+      mission_system_.renderMissions(screen_, false);
+      screen_.flush();
+      break;
+    case ScriptVerb::END:
+      endDay();
+      break;
+    case ScriptVerb::QUIT:
+      leaveGame();
+      break;
+    case ScriptVerb::NONE:
+    case ScriptVerb::INVALID:
+      break;
+  }
+  return true;
+}
+
+void Game::setEventSink(EventSink& sink) {
+  zoo_.setEventSink(sink);
+  player_.setEventSink(sink);
+}
+
+void Game::setCampaign(const Campaign& campaign) {
+  mission_system_.setCampaign(campaign);
+}
+
+const Zoo& Game::getZoo() const {
+  return zoo_;
+}
+
+const std::vector<Mission>& Game::getMissions() const {
+  return mission_system_.getMissions();
+}
+
+const GameResult& Game::getResult() const {
+  return result_;
+}
+
+uint64_t Game::getSeed() const {
+  return seed_;
+}
+
+bool Game::isRunning() const {
+  return running_;
+}
+
+Animal* Game::findAnimalByName(std::string_view name) const {
+  for (Animal* animal : zoo_.animalView()) {
+    if (animal->getName() == name) {
+      return animal;
+    }
+  }
+  return nullptr;
+}
+
+Exhibit* Game::findExhibitByName(std::string_view name) const {
+  for (Exhibit* exhibit : zoo_.exhibitView()) {
+    if (exhibit->getName() == name) {
+      return exhibit;
+    }
+  }
+  return nullptr;
+}
+
 void Game::clearInput() {
   std::cin.clear();
   std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -73,50 +286,52 @@ void Game::clearInput() {
 int Game::getPlayerInput(int min, int max) {
   int choice;
   while (true) {
-    std::cout << "> Select an option (" << min << "-" << max << "): ";
+    out_ << "> Select an option (" << min << "-" << max << "): ";
     if (std::cin >> choice && choice >= min && choice <= max) {
       clearInput();
       return choice;
     }
-    std::cout << "Invalid input. Please try again.\n";
+    out_ << "Invalid input. Please try again.\n";
     clearInput();
   }
 }
 
 void Game::displayMainMenu() {
-  std::cout << "\nMAIN MENU | Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-            << " | Actions: " << action_points_ << "/" << max_action_points_ << "\n";
-  std::cout << "----------------------------------------------------------------------\n";
-  std::cout << "1. Help\n";
-  std::cout << "2. View Missions\n";
-  std::cout << "3. Manage Animals\n";
-  std::cout << "4. Manage Exhibits\n";
-  std::cout << "5. Manage Zoo\n";
-  std::cout << "6. End Day\n";
-  std::cout << "7. Exit Game\n";
-  std::cout << "----------------------------------------------------------------------\n\n";
+  screen_ << "\nMAIN MENU | Balance: $" << Fixed{zoo_.getBalance(), 0} << " | Actions: "
+          << action_points_ << "/" << max_action_points_ << "\n";
+  screen_ << "----------------------------------------------------------------------\n";
+  screen_ << "1. Help\n";
+  screen_ << "2. View Missions\n";
+  screen_ << "3. Manage Animals\n";
+  screen_ << "4. Manage Exhibits\n";
+  screen_ << "5. Manage Zoo\n";
+  screen_ << "6. End Day\n";
+  screen_ << "7. Exit Game\n";
+  screen_ << "----------------------------------------------------------------------\n\n";
+  screen_.flush();
 }
 
 void Game::manageAnimals() {
   while (true) {
-    std::cout << "\nANIMAL MANAGEMENT | Actions: " << action_points_ << "/" << max_action_points_
-              << "\n";
-    std::cout << "----------------------------------------------------------------------\n";
-    std::cout << "1. Display All Animals\n";
-    std::cout << "2. Display Animals Needing Attention\n";
-    std::cout << "3. Rename Animal\n";
-    std::cout << "4. Purchase Animal\n";
-    std::cout << "5. Sell Animal\n";
-    std::cout << "6. Feed Animal (1 AP)\n";
-    std::cout << "7. Play With Animal (1 AP)\n";
-    std::cout << "8. Exercise Animal (1 AP)\n";
-    std::cout << "9. Treat Animal (1 AP)\n";
-    std::cout << "10. Add Animal to Exhibit\n";
-    std::cout << "11. Remove Animal from Exhibit\n";
-    std::cout << "12. Move Animal to Exhibit\n";
-    std::cout << "13. Back to Main Menu\n";
-    std::cout << "----------------------------------------------------------------------\n\n";
-
+    screen_ << "\nANIMAL MANAGEMENT | Actions: " << action_points_ << "/" << max_action_points_
+            << "\n";
+    screen_ << "----------------------------------------------------------------------\n";
+    screen_ << "1. Display All Animals\n";
+    screen_ << "2. Display Animals Needing Attention\n";
+    screen_ << "3. Rename Animal\n";
+    screen_ << "4. Purchase Animal\n";
+    screen_ << "5. Sell Animal\n";
+    screen_ << "6. Feed Animal (1 AP)\n";
+    screen_ << "7. Play With Animal (1 AP)\n";
+    screen_ << "8. Exercise Animal (1 AP)\n";
+    screen_ << "9. Treat Animal (1 AP)\n";
+    screen_ << "10. Add Animal to Exhibit\n";
+    screen_ << "11. Remove Animal from Exhibit\n";
+    screen_ << "12. Move Animal to Exhibit\n";
+    screen_ << "13. Back to Main Menu\n";
+    screen_ << "----------------------------------------------------------------------\n\n";
+
+    screen_.flush();
     int choice = getPlayerInput(1, 13);
     switch (choice) {
       case 1:
@@ -162,20 +377,21 @@ void Game::manageAnimals() {
 }
 
 Animal* Game::chooseAnimal() {
-  std::vector<Animal*> animals = zoo_.getAllAnimals();
+  AnimalView animals = zoo_.animalView();
   if (animals.empty()) {
-    std::cout << "No animals in zoo.\n";
+    out_ << "No animals in zoo.\n";
     return nullptr;
   }
-  std::cout << "\nChoose an animal:\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "\nChoose an animal:\n";
+  screen_ << "----------------------------------------------------------------------\n";
   for (size_t i = 0; i < animals.size(); ++i) {
-    std::cout << (i + 1) << ". " << animals[i]->getName() << " the " << animals[i]->getSpecies()
-              << "\n";
+    screen_ << (i + 1) << ". " << animals[i]->getName() << " the " << animals[i]->getSpecies()
+            << "\n";
   }
-  std::cout << (animals.size() + 1) << ". Cancel\n";
-  std::cout << "----------------------------------------------------------------------\n\n";
+  screen_ << (animals.size() + 1) << ". Cancel\n";
+  screen_ << "----------------------------------------------------------------------\n\n";
 
+  screen_.flush();
   int choice = getPlayerInput(1, static_cast<int>(animals.size() + 1));
   if (choice == static_cast<int>(animals.size() + 1)) {
     return nullptr;
@@ -184,68 +400,71 @@ Animal* Game::chooseAnimal() {
 }
 
 void Game::displayAllAnimals() {
-  std::vector<Animal*> animals = zoo_.getAllAnimals();
+  AnimalView animals = zoo_.animalView();
   if (animals.empty()) {
-    std::cout << "No animals in zoo yet.\n";
+    out_ << "No animals in zoo yet.\n";
     return;
   }
 
-  std::cout << "\nALL ANIMALS\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "\nALL ANIMALS\n";
+  screen_ << "----------------------------------------------------------------------\n";
   for (size_t i = 0; i < animals.size(); ++i) {
     Animal* animal = animals[i];
-    std::cout << (i + 1) << ". " << animal->getName() << " the " << animal->getSpecies() << "\n";
-    std::cout << "   Age:        " << animal->getAge() << "\n";
-    std::cout << "   Health:     " << animal->getHealthLevel() << "\n";
-    std::cout << "   Hunger:     " << animal->getHungerLevel() << "\n";
-    std::cout << "   Happiness:  " << animal->getHappinessLevel() << "\n";
-    std::cout << "   Energy:     " << animal->getEnergyLevel() << "\n";
+    screen_ << (i + 1) << ". " << animal->getName() << " the " << animal->getSpecies() << "\n";
+    screen_ << "   Age:        " << animal->getAge() << "\n";
+    screen_ << "   Health:     " << animal->getHealthLevel() << "\n";
+    screen_ << "   Hunger:     " << animal->getHungerLevel() << "\n";
+    screen_ << "   Happiness:  " << animal->getHappinessLevel() << "\n";
+    screen_ << "   Energy:     " << animal->getEnergyLevel() << "\n";
     Exhibit* exhibit = zoo_.findAnimalLocation(animal);
     if (exhibit) {
-      if (exhibit->getType() == animal->getPreferredHabitat()) {
-        std::cout << "   Location:   " << exhibit->getName() << " (Perfect Match!)\n";
+      if (exhibit->getHabitat() == animal->getHabitat()) {
+        screen_ << "   Location:   " << exhibit->getName() << " (Perfect Match!)\n";
       } else {
-        std::cout << "   Location:   " << exhibit->getName() << " (Wrong Habitat!)\n";
+        screen_ << "   Location:   " << exhibit->getName() << " (Wrong Habitat!)\n";
       }
     } else {
-      std::cout << "   Location:   Homeless\n";
+      screen_ << "   Location:   Homeless\n";
     }
 
     if (i < animals.size() - 1) {
-      std::cout << "----------------------------------------------------------------------\n";
+      screen_ << "----------------------------------------------------------------------\n";
     }
   }
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "----------------------------------------------------------------------\n";
+  screen_.flush();
 }
 
 void Game::displayAnimalStats(Animal* animal) {
   if (!animal) {
     return;
   }
-  std::cout << "\n" << animal->getName() << " the " << animal->getSpecies() << "\n";
-  std::cout << "   Health:     " << animal->getHealthLevel() << "\n";
-  std::cout << "   Hunger:     " << animal->getHungerLevel() << "\n";
-  std::cout << "   Happiness:  " << animal->getHappinessLevel() << "\n";
-  std::cout << "   Energy:     " << animal->getEnergyLevel() << "\n\n";
+  screen_ << "\n" << animal->getName() << " the " << animal->getSpecies() << "\n";
+  screen_ << "   Health:     " << animal->getHealthLevel() << "\n";
+  screen_ << "   Hunger:     " << animal->getHungerLevel() << "\n";
+  screen_ << "   Happiness:  " << animal->getHappinessLevel() << "\n";
+  screen_ << "   Energy:     " << animal->getEnergyLevel() << "\n\n";
+  screen_.flush();
 }
 
 void Game::displayAnimalsNeedingAttention() {
-  std::vector<Animal*> animals = zoo_.getAnimalsNeedingAttention();
+  AnimalsNeedingAttention animals = zoo_.animalsNeedingAttention();
   if (animals.empty()) {
-    std::cout << "\nNo animals need attention right now!\n";
+    out_ << "\nNo animals need attention right now!\n";
     return;
   }
 
-  std::cout << "\nANIMALS NEEDING ATTENTION\n";
-  for (size_t i = 0; i < animals.size(); ++i) {
-    Animal* animal = animals[i];
-    std::cout << "----------------------------------------------------------------------\n";
-    std::cout << (i + 1) << ". " << animal->getName() << " the " << animal->getSpecies() << "\n";
-    std::cout << "   Health:    " << animal->getHealthLevel() << "\n";
-    std::cout << "   Hunger:    " << animal->getHungerLevel() << "\n";
-    std::cout << "   Happiness: " << animal->getHappinessLevel() << "\n";
-    std::cout << "   Energy:    " << animal->getEnergyLevel() << "\n";
+  screen_ << "\nANIMALS NEEDING ATTENTION\n";
+  size_t i = 0;
+  for (Animal* animal : animals) {
+    screen_ << "----------------------------------------------------------------------\n";
+    screen_ << (++i) << ". " << animal->getName() << " the " << animal->getSpecies() << "\n";
+    screen_ << "   Health:    " << animal->getHealthLevel() << "\n";
+    screen_ << "   Hunger:    " << animal->getHungerLevel() << "\n";
+    screen_ << "   Happiness: " << animal->getHappinessLevel() << "\n";
+    screen_ << "   Energy:    " << animal->getEnergyLevel() << "\n";
   }
+  screen_.flush();
 }
 
 void Game::renameAnimal() {
@@ -255,120 +474,95 @@ void Game::renameAnimal() {
   }
 
   std::string old_name = animal->getName();
-  std::cout << "> Enter new name: ";
+  out_ << "> Enter new name: ";
   std::string name;
   std::getline(std::cin, name);
 
-  std::cout << "  Rename " << old_name << " the " << animal->getSpecies() << " to " << name
-            << " the " << animal->getSpecies() << "? (1 - Yes, 2 - No)\n";
+  out_ << "  Rename " << old_name << " the " << animal->getSpecies() << " to " << name << " the "
+       << animal->getSpecies() << "? (1 - Yes, 2 - No)\n";
 
   int choice = getPlayerInput(1, 2);
 
   if (choice == 1) {
     animal->setName(name);
-    std::cout << "Renamed " << old_name << " the " << animal->getSpecies() << " to " << name
-              << " the " << animal->getSpecies() << "!\n";
+    out_ << "Renamed " << old_name << " the " << animal->getSpecies() << " to " << name << " the "
+         << animal->getSpecies() << "!\n";
   }
 }
 
 void Game::purchaseAnimal() {
-  std::cout << "\nPURCHASE ANIMAL | Balance: $" << std::fixed << std::setprecision(0)
-            << zoo_.getBalance() << "\n";
-  std::cout << "----------------------------------------------------------------------\n";
-  std::cout << "1. Rabbit - $150 [Grassland]\n";
-  std::cout << "2. Tortoise - $250 [Grassland]\n";
-  std::cout << "3. Penguin - $400 [Arctic]\n";
-  std::cout << "4. Monkey - $600 [Jungle]\n";
-  std::cout << "5. Bear - $800 [Forest]\n";
-  std::cout << "6. Lion - $1000 [Savanna]\n";
-  std::cout << "7. Elephant - $1200 [Savanna]\n";
-  std::cout << "8. Cancel\n";
-  std::cout << "----------------------------------------------------------------------\n\n";
+  out_ << "\nPURCHASE ANIMAL | Balance: $" << std::fixed << std::setprecision(0)
+       << zoo_.getBalance() << "\n";
+  out_ << "----------------------------------------------------------------------\n";
+  out_ << "1. Rabbit - $150 [Grassland]\n";
+  out_ << "2. Tortoise - $250 [Grassland]\n";
+  out_ << "3. Penguin - $400 [Arctic]\n";
+  out_ << "4. Monkey - $600 [Jungle]\n";
+  out_ << "5. Bear - $800 [Forest]\n";
+  out_ << "6. Lion - $1000 [Savanna]\n";
+  out_ << "7. Elephant - $1200 [Savanna]\n";
+  out_ << "8. Cancel\n";
+  out_ << "----------------------------------------------------------------------\n\n";
 
   int choice = getPlayerInput(1, 8);
   if (choice == 8) {
     return;
   }
 
-  std::cout << "\n> Name your animal: ";
+  out_ << "\n> Name your animal: ";
   std::string name;
   std::getline(std::cin, name);
 
-  // random number generator
-  std::random_device seed;
-  std::mt19937 gen(seed());
+  std::unique_ptr<Animal> animal = makeAnimal(MENU_SPECIES[choice - 1], name);
 
-  std::unique_ptr<Animal> animal;
-  int age;
+  out_ << "  Purchase " << animal->getName() << " the " << animal->getSpecies() << " for $"
+       << animal->getPurchaseCost() << "? (1 - Yes, 2 - No)\n";
+  out_ << "  - Daily Cost: $" << (animal->getFeedingCost() + animal->getMaintenanceCost())
+       << " (Feeding: $" << animal->getFeedingCost() << ", Maintenance: $"
+       << animal->getMaintenanceCost() << ")\n";
+  out_ << "  - Preferred Habitat: " << animal->getPreferredHabitat() << "\n";
+  choice = getPlayerInput(1, 2);
 
-  switch (choice) {
-    case 1: {
-      std::uniform_int_distribution<> distr(1, 8);
-      age = distr(gen);
-      animal = std::make_unique<Rabbit>(name, age);
-      break;
-    }
-    case 2: {
-      std::uniform_int_distribution<> distr(10, 50);
-      age = distr(gen);
-      animal = std::make_unique<Tortoise>(name, age);
-      break;
-    }
-    case 3: {
-      std::uniform_int_distribution<> distr(5, 20);
-      age = distr(gen);
-      animal = std::make_unique<Penguin>(name, age);
-      break;
-    }
-    case 4: {
-      std::uniform_int_distribution<> distr(3, 15);
-      age = distr(gen);
-      animal = std::make_unique<Monkey>(name, age);
-      break;
-    }
-    case 5: {
-      std::uniform_int_distribution<> distr(3, 25);
-      age = distr(gen);
-      animal = std::make_unique<Bear>(name, age);
-      break;
-    }
-    case 6: {
-      std::uniform_int_distribution<> distr(4, 20);
-      age = distr(gen);
-      animal = std::make_unique<Lion>(name, age);
-      break;
-    }
-    case 7: {
-      std::uniform_int_distribution<> distr(10, 60);
-      age = distr(gen);
-      animal = std::make_unique<Elephant>(name, age);
-      break;
-    }
+  if (choice == 1) {
+    buyAnimal(std::move(animal));
   }
+}
 
-  std::cout << "  Purchase " << animal->getName() << " the " << animal->getSpecies() << " for $"
-            << animal->getPurchaseCost() << "? (1 - Yes, 2 - No)\n";
-  std::cout << "  - Daily Cost: $" << (animal->getFeedingCost() + animal->getMaintenanceCost())
-            << " (Feeding: $" << animal->getFeedingCost() << ", Maintenance: $"
-            << animal->getMaintenanceCost() << ")\n";
-  std::cout << "  - Preferred Habitat: " << animal->getPreferredHabitat() << "\n";
-  choice = getPlayerInput(1, 2);
+std::unique_ptr<Animal> Game::makeAnimal(Species species, const std::string& name) {
+  const AgeRange& ages = SPECIES_AGES[static_cast<size_t>(species)];
+  int age = zoo_.getRng().rollBetween(ages.min, ages.max);
+
+  switch (species) {
+    case Species::LION:
+      return std::make_unique<Lion>(name, age);
+    case Species::BEAR:
+      return std::make_unique<Bear>(name, age);
+    case Species::ELEPHANT:
+      return std::make_unique<Elephant>(name, age);
+    case Species::MONKEY:
+      return std::make_unique<Monkey>(name, age);
+    case Species::PENGUIN:
+      return std::make_unique<Penguin>(name, age);
+    case Species::RABBIT:
+      return std::make_unique<Rabbit>(name, age);
+    case Species::TORTOISE:
+      return std::make_unique<Tortoise>(name, age);
+  }
+  return nullptr;
+}
 
-  if (choice == 1) {
-    if (zoo_.purchaseAnimal(std::move(animal))) {
-      updateMaxActionPoints();
-      std::cout << "\nNew Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-                << "\n";
-
-      std::vector<Animal*> animals = zoo_.getAllAnimals();
-      Animal* purchased_animal = animals.back();
-      purchases_.push_back(
-          {"Animal: " + purchased_animal->getName() + " (" + purchased_animal->getSpecies() + ")",
-           purchased_animal->getPurchaseCost()});
-      total_purchase_amount_ += purchased_animal->getPurchaseCost();
-
-      mission_system_.checkMissions(false);
-    }
+void Game::buyAnimal(std::unique_ptr<Animal> animal) {
+  if (zoo_.purchaseAnimal(std::move(animal))) {
+    updateMaxActionPoints();
+    out_ << "\nNew Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
+
+    Animal* purchased_animal = zoo_.animalView().back();
+    purchases_.push_back(
+        {"Animal: " + purchased_animal->getName() + " (" + purchased_animal->getSpecies() + ")",
+         purchased_animal->getPurchaseCost()});
+    total_purchase_amount_ += purchased_animal->getPurchaseCost();
+
+    mission_system_.checkMissions(false);
   }
 }
 
@@ -378,44 +572,48 @@ void Game::sellAnimal() {
     return;
   }
 
-  std::cout << "  Sell " << animal->getName() << " the " << animal->getSpecies() << " for $"
-            << (animal->getPurchaseCost() / 2.0) << "? (1 - Yes, 2 - No)\n";
+  out_ << "  Sell " << animal->getName() << " the " << animal->getSpecies() << " for $"
+       << (animal->getPurchaseCost() / 2.0) << "? (1 - Yes, 2 - No)\n";
   int choice = getPlayerInput(1, 2);
 
   if (choice == 1) {
-    if (zoo_.sellAnimal(animal)) {
-      updateMaxActionPoints();
-      std::cout << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-                << "\n";
-    }
+    sellAnimal(animal);
+  }
+}
+
+void Game::sellAnimal(Animal* animal) {
+  if (zoo_.sellAnimal(animal)) {
+    updateMaxActionPoints();
+    out_ << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
   }
 }
 
 void Game::feedAnimal() {
-  Animal* animal = chooseAnimal();
-  if (!animal) {
-    return;
+  if (Animal* animal = chooseAnimal()) {
+    feedAnimal(animal);
   }
+}
 
+void Game::feedAnimal(Animal* animal) {
   if (!useActionPoint("Fed " + animal->getName())) {
     return;
   }
 
   if (player_.feedAnimal(zoo_, animal)) {
     displayAnimalStats(animal);
-    std::cout << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-              << "\n";
+    out_ << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
     mission_system_.trackAnimalFed(animal);
   }
   mission_system_.checkMissions(false);
 }
 
 void Game::playWithAnimal() {
-  Animal* animal = chooseAnimal();
-  if (!animal) {
-    return;
+  if (Animal* animal = chooseAnimal()) {
+    playWithAnimal(animal);
   }
+}
 
+void Game::playWithAnimal(Animal* animal) {
   if (!useActionPoint("Played with " + animal->getName())) {
     return;
   }
@@ -428,11 +626,12 @@ void Game::playWithAnimal() {
 }
 
 void Game::exerciseAnimal() {
-  Animal* animal = chooseAnimal();
-  if (!animal) {
-    return;
+  if (Animal* animal = chooseAnimal()) {
+    exerciseAnimal(animal);
   }
+}
 
+void Game::exerciseAnimal(Animal* animal) {
   if (!useActionPoint("Exercised " + animal->getName())) {
     return;
   }
@@ -445,19 +644,19 @@ void Game::exerciseAnimal() {
 }
 
 void Game::treatAnimal() {
-  Animal* animal = chooseAnimal();
-  if (!animal) {
-    return;
+  if (Animal* animal = chooseAnimal()) {
+    treatAnimal(animal);
   }
+}
 
+void Game::treatAnimal(Animal* animal) {
   if (!useActionPoint("Treated " + animal->getName())) {
     return;
   }
 
   if (player_.treatAnimal(zoo_, animal)) {
     displayAnimalStats(animal);
-    std::cout << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-              << "\n";
+    out_ << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
   }
 }
 
@@ -471,19 +670,24 @@ void Game::addAnimalToExhibit() {
   if (!exhibit) {
     return;
   }
+  addAnimalToExhibit(animal, exhibit);
+}
+
+void Game::addAnimalToExhibit(Animal* animal, Exhibit* exhibit) {
   zoo_.addAnimalToExhibit(animal, exhibit);
   mission_system_.checkMissions(false);
 }
 
 void Game::removeAnimalFromExhibit() {
-  Animal* animal = chooseAnimal();
-  if (!animal) {
-    return;
+  if (Animal* animal = chooseAnimal()) {
+    removeAnimalFromExhibit(animal);
   }
+}
 
+void Game::removeAnimalFromExhibit(Animal* animal) {
   Exhibit* exhibit = zoo_.findAnimalLocation(animal);
   if (!exhibit) {
-    std::cout << animal->getName() << " is not in any exhibit!\n";
+    out_ << animal->getName() << " is not in any exhibit!\n";
     return;
   }
 
@@ -500,23 +704,28 @@ void Game::moveAnimalToExhibit() {
   if (!exhibit) {
     return;
   }
+  moveAnimalToExhibit(animal, exhibit);
+}
+
+void Game::moveAnimalToExhibit(Animal* animal, Exhibit* exhibit) {
   zoo_.moveAnimalToExhibit(animal, exhibit);
 }
 
 void Game::manageExhibits() {
   while (true) {
-    std::cout << "\nEXHIBIT MANAGEMENT | Actions: " << action_points_ << "/" << max_action_points_
-              << "\n";
-    std::cout << "----------------------------------------------------------------------\n";
-    std::cout << "1. Display All Exhibits\n";
-    std::cout << "2. Display Exhibits Needing Cleaning\n";
-    std::cout << "3. Rename Exhibit\n";
-    std::cout << "4. Purchase Exhibit\n";
-    std::cout << "5. Sell Exhibit\n";
-    std::cout << "6. Clean Exhibit (1 AP)\n";
-    std::cout << "7. Back to Main Menu\n";
-    std::cout << "----------------------------------------------------------------------\n\n";
-
+    screen_ << "\nEXHIBIT MANAGEMENT | Actions: " << action_points_ << "/" << max_action_points_
+            << "\n";
+    screen_ << "----------------------------------------------------------------------\n";
+    screen_ << "1. Display All Exhibits\n";
+    screen_ << "2. Display Exhibits Needing Cleaning\n";
+    screen_ << "3. Rename Exhibit\n";
+    screen_ << "4. Purchase Exhibit\n";
+    screen_ << "5. Sell Exhibit\n";
+    screen_ << "6. Clean Exhibit (1 AP)\n";
+    screen_ << "7. Back to Main Menu\n";
+    screen_ << "----------------------------------------------------------------------\n\n";
+
+    screen_.flush();
     int choice = getPlayerInput(1, 7);
     switch (choice) {
       case 1:
@@ -544,22 +753,22 @@ void Game::manageExhibits() {
 }
 
 Exhibit* Game::chooseExhibit() {
-  std::vector<Exhibit*> exhibits = zoo_.getAllExhibits();
+  ExhibitView exhibits = zoo_.exhibitView();
   if (exhibits.empty()) {
-    std::cout << "No exhibits in zoo.\n";
+    out_ << "No exhibits in zoo.\n";
     return nullptr;
   }
 
-  std::cout << "\nChoose an exhibit:\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "\nChoose an exhibit:\n";
+  screen_ << "----------------------------------------------------------------------\n";
   for (size_t i = 0; i < exhibits.size(); ++i) {
-    std::cout << (i + 1) << ". " << exhibits[i]->getName() << " (" << exhibits[i]->getType()
-              << ")\n";
+    screen_ << (i + 1) << ". " << exhibits[i]->getName() << " (" << exhibits[i]->getType() << ")\n";
   }
 
-  std::cout << (exhibits.size() + 1) << ". Cancel\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << (exhibits.size() + 1) << ". Cancel\n";
+  screen_ << "----------------------------------------------------------------------\n";
 
+  screen_.flush();
   int choice = getPlayerInput(1, static_cast<int>(exhibits.size() + 1));
   if (choice == static_cast<int>(exhibits.size() + 1)) {
     return nullptr;
@@ -569,37 +778,40 @@ Exhibit* Game::chooseExhibit() {
 }
 
 void Game::displayAllExhibits() {
-  std::vector<Exhibit*> exhibits = zoo_.getAllExhibits();
+  ExhibitView exhibits = zoo_.exhibitView();
   if (exhibits.empty()) {
-    std::cout << "No exhibits in zoo yet.\n";
+    out_ << "No exhibits in zoo yet.\n";
     return;
   }
 
-  std::cout << "\nEXHIBITS\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "\nEXHIBITS\n";
+  screen_ << "----------------------------------------------------------------------\n";
   for (size_t i = 0; i < exhibits.size(); ++i) {
     Exhibit* exhibit = exhibits[i];
-    std::cout << (i + 1) << ". " << exhibit->getName() << " (" << exhibit->getType() << ")\n";
-    std::cout << "   Capacity:     " << exhibit->getCapacityUsed() << "/"
-              << exhibit->getMaxCapacity() << "\n";
-    std::cout << "   Cleanliness:  " << exhibit->getCleanliness() << "\n";
+    screen_ << (i + 1) << ". " << exhibit->getName() << " (" << exhibit->getType() << ")\n";
+    screen_ << "   Capacity:     " << exhibit->getCapacityUsed() << "/" << exhibit->getMaxCapacity()
+            << "\n";
+    screen_ << "   Cleanliness:  " << exhibit->getCleanliness() << "\n";
     if (i < exhibits.size() - 1) {
-      std::cout << "----------------------------------------------------------------------\n";
+      screen_ << "----------------------------------------------------------------------\n";
     }
   }
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "----------------------------------------------------------------------\n";
+  screen_.flush();
 }
 
 void Game::displayExhibitsNeedingCleaning() {
-  std::vector<Exhibit*> exhibits = zoo_.getExhibitsNeedingCleaning();
+  ExhibitsNeedingCleaning exhibits = zoo_.exhibitsNeedingCleaning();
   if (exhibits.empty()) {
-    std::cout << "\nNo exhibits need cleaning right now!\n";
+    out_ << "\nNo exhibits need cleaning right now!\n";
     return;
   }
 
-  for (size_t i = 0; i < exhibits.size(); ++i) {
-    std::cout << (i + 1) << ". " << exhibits[i]->getName() << "\n";
+  size_t i = 0;
+  for (Exhibit* exhibit : exhibits) {
+    screen_ << (++i) << ". " << exhibit->getName() << "\n";
   }
+  screen_.flush();
 }
 
 void Game::renameExhibit() {
@@ -609,97 +821,72 @@ void Game::renameExhibit() {
   }
 
   std::string old_name = exhibit->getName();
-  std::cout << "> Enter new name: ";
+  out_ << "> Enter new name: ";
   std::string name;
   std::getline(std::cin, name);
 
-  std::cout << "  Rename Exhibit " << old_name << " to Exhibit " << name << "? (1 - Yes, 2 - No)\n";
+  out_ << "  Rename Exhibit " << old_name << " to Exhibit " << name << "? (1 - Yes, 2 - No)\n";
   int choice = getPlayerInput(1, 2);
   if (choice == 1) {
     exhibit->setName(name);
-    std::cout << "Renamed Exhibit " << old_name << " to Exhibit " << name << ".\n";
+    out_ << "Renamed Exhibit " << old_name << " to Exhibit " << name << ".\n";
   }
 }
 
 void Game::purchaseExhibit() {
-  std::cout << "\nPURCHASE EXHIBIT | Balance: $" << std::fixed << std::setprecision(0)
-            << zoo_.getBalance() << "\n";
-  std::cout << "----------------------------------------------------------------------\n";
-  std::cout << "1. Grassland (2-3 capacity) - $300\n";
-  std::cout << "2. Forest (3-4 capacity) - $600\n";
-  std::cout << "3. Jungle (4-6 capacity) - $800\n";
-  std::cout << "4. Savannna (3-5 capacity) - $1000\n";
-  std::cout << "5. Arctic (4-5 capacity) - $1200\n";
-  std::cout << "6. Cancel\n";
-  std::cout << "----------------------------------------------------------------------\n\n";
+  out_ << "\nPURCHASE EXHIBIT | Balance: $" << std::fixed << std::setprecision(0)
+       << zoo_.getBalance() << "\n";
+  out_ << "----------------------------------------------------------------------\n";
+  out_ << "1. Grassland (2-3 capacity) - $300\n";
+  out_ << "2. Forest (3-4 capacity) - $600\n";
+  out_ << "3. Jungle (4-6 capacity) - $800\n";
+  out_ << "4. Savannna (3-5 capacity) - $1000\n";
+  out_ << "5. Arctic (4-5 capacity) - $1200\n";
+  out_ << "6. Cancel\n";
+  out_ << "----------------------------------------------------------------------\n\n";
 
   int choice = getPlayerInput(1, 6);
   if (choice == 6) {
     return;
   }
 
-  std::cout << "> Name the exhibit: ";
+  out_ << "> Name the exhibit: ";
   std::string name;
   std::getline(std::cin, name);
 
-  // random number generator
-  std::random_device seed;
-  std::mt19937 gen(seed());
-
-  int capacity;
-  std::unique_ptr<Exhibit> exhibit;
-  switch (choice) {
-    case 1: {
-      std::uniform_int_distribution<> distr(2, 3);
-      capacity = distr(gen);
-      exhibit = std::make_unique<Exhibit>(name, "Grassland", capacity, 300.0, 15.0);
-      break;
-    }
-    case 2: {
-      std::uniform_int_distribution<> distr(3, 4);
-      capacity = distr(gen);
-      exhibit = std::make_unique<Exhibit>(name, "Forest", capacity, 600.0, 35.0);
-      break;
-    }
-    case 3: {
-      std::uniform_int_distribution<> distr(4, 6);
-      capacity = distr(gen);
-      exhibit = std::make_unique<Exhibit>(name, "Jungle", capacity, 800.0, 45.0);
-      break;
-    }
-    case 4: {
-      std::uniform_int_distribution<> distr(3, 5);
-      capacity = distr(gen);
-      exhibit = std::make_unique<Exhibit>(name, "Savanna", capacity, 1000.0, 50.0);
-      break;
-    }
-    case 5: {
-      std::uniform_int_distribution<> distr(4, 5);
-      capacity = distr(gen);
-      exhibit = std::make_unique<Exhibit>(name, "Arctic", capacity, 1200.0, 60.0);
-      break;
-    }
-  }
+  std::unique_ptr<Exhibit> exhibit = makeExhibit(MENU_HABITATS[choice - 1], name);
 
-  std::cout << "  Purchase Exhibit " << exhibit->getName() << " (" << exhibit->getType()
-            << ") for $" << exhibit->getPurchaseCost() << "? (1 - Yes, 2 - No)\n";
+  out_ << "  Purchase Exhibit " << exhibit->getName() << " (" << exhibit->getType() << ") for $"
+       << exhibit->getPurchaseCost() << "? (1 - Yes, 2 - No)\n";
 
   choice = getPlayerInput(1, 2);
 
   if (choice == 1) {
-    if (zoo_.purchaseExhibit(std::move(exhibit))) {
-      updateMaxActionPoints();
-      std::cout << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-                << "\n";
-
-      std::vector<Exhibit*> exhibits = zoo_.getAllExhibits();
-      Exhibit* purchased_exhibit = exhibits.back();
-      purchases_.push_back(
-          {"Exhibit: " + purchased_exhibit->getName() + " (" + purchased_exhibit->getType() + ")",
-           purchased_exhibit->getPurchaseCost()});
-      total_purchase_amount_ += purchased_exhibit->getPurchaseCost();
-      mission_system_.checkMissions(false);
-    }
+    buyExhibit(std::move(exhibit));
+  }
+}
+
+std::unique_ptr<Exhibit> Game::makeExhibit(Habitat habitat, const std::string& name) {
+  if (habitat == Habitat::UNKNOWN) {
+    return nullptr;
+  }
+  const HabitatTraits& traits = habitatTraits(habitat);
+  int capacity = zoo_.getRng().rollBetween(traits.min_capacity, traits.max_capacity);
+  return std::make_unique<Exhibit>(name, std::string(habitatName(habitat)), capacity,
+                                   traits.purchase_cost, traits.maintenance_cost);
+}
+
+void Game::buyExhibit(std::unique_ptr<Exhibit> exhibit) {
+  if (zoo_.purchaseExhibit(std::move(exhibit))) {
+    updateMaxActionPoints();
+    out_ << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
+
+    Exhibit* purchased_exhibit = zoo_.exhibitView().back();
+    purchases_.push_back(
+        {"Exhibit: " + purchased_exhibit->getName() + " (" + purchased_exhibit->getType() + ")",
+         purchased_exhibit->getPurchaseCost()});
+    total_purchase_amount_ += purchased_exhibit->getPurchaseCost();
+    mission_system_.checkMissions(false);
   }
 }
 
@@ -708,27 +895,32 @@ void Game::sellExhibit() {
   if (!exhibit) {
     return;
   }
-  std::cout << "  Sell " << exhibit->getName() << " for $" << (exhibit->getPurchaseCost() / 2.0)
-            << "? (1 - Yes, 2 - No)\n";
+  out_ << "  Sell " << exhibit->getName() << " for $" << (exhibit->getPurchaseCost() / 2.0)
+       << "? (1 - Yes, 2 - No)\n";
   int choice = getPlayerInput(1, 2);
 
   if (choice == 1) {
-    if (zoo_.sellExhibit(exhibit)) {
-      updateMaxActionPoints();
-      std::cout << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-                << "\n";
-    }
+    sellExhibit(exhibit);
+  }
+}
+
+void Game::sellExhibit(Exhibit* exhibit) {
+  if (zoo_.sellExhibit(exhibit)) {
+    updateMaxActionPoints();
+    out_ << "New Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
   }
 }
 
 void Game::cleanExhibit() {
-  Exhibit* exhibit = chooseExhibit();
-  if (!exhibit) {
-    return;
+  if (Exhibit* exhibit = chooseExhibit()) {
+    cleanExhibit(exhibit);
   }
+}
+
+void Game::cleanExhibit(Exhibit* exhibit) {
   // check if exhibit needs cleaning first
-  if (exhibit->getCleanliness() > 70) {
-    std::cout << "\nExhibit does not need to be cleaned yet!\n";
+  if (exhibit->getCleanliness() > Exhibit::CLEANABLE_AT_MOST) {
+    out_ << "\nExhibit does not need to be cleaned yet!\n";
     return;
   }
 
@@ -744,13 +936,14 @@ void Game::cleanExhibit() {
 
 void Game::manageZoo() {
   while (true) {
-    std::cout << "\nZOO MANAGEMENT\n";
-    std::cout << "----------------------------------------------------------------------\n";
-    std::cout << "1. Check Balance\n";
-    std::cout << "2. View Zoo Rating\n";
-    std::cout << "3. Back to Main Menu\n";
-    std::cout << "----------------------------------------------------------------------\n\n";
-
+    screen_ << "\nZOO MANAGEMENT\n";
+    screen_ << "----------------------------------------------------------------------\n";
+    screen_ << "1. Check Balance\n";
+    screen_ << "2. View Zoo Rating\n";
+    screen_ << "3. Back to Main Menu\n";
+    screen_ << "----------------------------------------------------------------------\n\n";
+
+    screen_.flush();
     int choice = getPlayerInput(1, 3);
 
     switch (choice) {
@@ -767,21 +960,20 @@ void Game::manageZoo() {
 }
 
 void Game::checkBalance() {
-  std::cout << "\nCurrent Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-            << "\n";
+  out_ << "\nCurrent Balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance() << "\n";
 }
 
 void Game::viewZooRating() {
   double rating = zoo_.calculateZooRating();
-  std::cout << "\nZoo Rating: " << std::fixed << std::setprecision(1) << rating << "/5.0 ";
-  std::cout << zoo_.getRatingMessage(rating) << "\n";
+  out_ << "\nZoo Rating: " << std::fixed << std::setprecision(1) << rating << "/5.0 ";
+  out_ << zoo_.getRatingMessage(rating) << "\n";
   zoo_.viewZooRatingBreakdown();
 }
 
 bool Game::useActionPoint(const std::string action_description) {
   if (action_points_ <= 0) {
-    std::cout << "No more action points remaining today!\n";
-    std::cout << "End the day to reset your actions.\n";
+    out_ << "No more action points remaining today!\n";
+    out_ << "End the day to reset your actions.\n";
     return false;
   }
 
@@ -817,14 +1009,14 @@ void Game::endDay() {
   mission_system_.checkMissions(true);
 
   if (mission_system_.checkMissionsImpossible(action_points_)) {
-    std::cout << "\nGAME OVER: You failed a required mission!\n";
-    running_ = false;
+    out_ << "\nGAME OVER: You failed a required mission!\n";
+    finishGame(GameOutcome::MISSION_FAILED);
     return;
   }
 
   if (!mission_system_.canAdvanceDay()) {
-    std::cout << "\nCannot advance to next day!\n";
-    std::cout << "Complete all required missions first.\n";
+    out_ << "\nCannot advance to next day!\n";
+    out_ << "Complete all required missions first.\n";
     return;
   }
 
@@ -836,32 +1028,35 @@ void Game::endDay() {
       mission_system_.completeMission(i);
     }
   }
+  result_.missions_offered += static_cast<int>(missions.size());
+  result_.missions_completed += static_cast<int>(
+      std::ranges::count_if(missions, [](const Mission& mission) { return mission.completed; }));
 
   zoo_.updateBalance();
-  mission_system_.displayMissions(true);
+  mission_system_.renderMissions(screen_, true);
 
-  std::cout << "\nEND OF DAY " << zoo_.getDay() << "\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "\nEND OF DAY " << zoo_.getDay() << "\n";
+  screen_ << "----------------------------------------------------------------------\n";
 
   // action summary
   if (actions_.empty()) {
-    std::cout << "No actions performed today.\n";
+    screen_ << "No actions performed today.\n";
   } else {
-    std::cout << "Actions Performed (" << (max_action_points_ - action_points_) << "/"
-              << max_action_points_ << "):\n";
+    screen_ << "Actions Performed (" << (max_action_points_ - action_points_) << "/"
+            << max_action_points_ << "):\n";
     for (size_t i = 0; i < actions_.size(); ++i) {
-      std::cout << "  " << (i + 1) << ". " << actions_[i] << "\n";
+      screen_ << "  " << (i + 1) << ". " << actions_[i] << "\n";
     }
   }
 
   // purchase summary
   if (purchases_.empty()) {
-    std::cout << "\nNo purchases made today.\n";
+    screen_ << "\nNo purchases made today.\n";
   } else {
-    std::cout << "\nPurchases made today (" << purchases_.size() << "):\n";
+    screen_ << "\nPurchases made today (" << purchases_.size() << "):\n";
     for (size_t i = 0; i < purchases_.size(); ++i) {
-      std::cout << "  " << (i + 1) << ". " << purchases_[i].first << " - $" << std::fixed
-                << std::setprecision(0) << purchases_[i].second << "\n";
+      screen_ << "  " << (i + 1) << ". " << purchases_[i].first << " - $"
+              << Fixed{purchases_[i].second, 0} << "\n";
     }
   }
 
@@ -870,35 +1065,36 @@ void Game::endDay() {
   purchases_.clear();
   total_purchase_amount_ = 0.0;
 
-  zoo_.displayEndOfDaySummary();
+  zoo_.renderEndOfDaySummary(screen_);
+  screen_.flush();
   zoo_.degradeStats();
 
   if (zoo_.getBalance() <= 0) {
-    std::cout << "\nGAME OVER: You went bankrupt!\n";
-    running_ = false;
+    out_ << "\nGAME OVER: You went bankrupt!\n";
+    finishGame(GameOutcome::BANKRUPT);
     return;
   }
 
   if (zoo_.getAnimalCount() == 0) {
-    std::cout << "\nGAME OVER: No animals left!\n";
-    running_ = false;
+    out_ << "\nGAME OVER: No animals left!\n";
+    finishGame(GameOutcome::NO_ANIMALS);
     return;
   }
 
   if (zoo_.getBalance() < 500) {
-    std::cout << "\nLow funds! Your zoo is at risk of bankruptcy!\n";
+    out_ << "\nLow funds! Your zoo is at risk of bankruptcy!\n";
   }
 
   zoo_.advanceDay();
 
-  if (zoo_.getDay() <= 10) {
+  if (zoo_.getDay() <= mission_system_.getDayCount()) {
     mission_system_.setupDailyMissions(zoo_.getDay());
   } else {
     handleGameCompletion();
     return;
   }
 
-  std::cout << "\nDAY " << zoo_.getDay() << "\n";
+  out_ << "\nDAY " << zoo_.getDay() << "\n";
 
   mission_system_.checkMissions(false);
 }
@@ -906,161 +1102,172 @@ void Game::endDay() {
 void Game::handleGameCompletion() {
   double rating = zoo_.calculateZooRating();
 
-  std::cout << "\nGAME COMPLETE!\n";
-  std::cout << "----------------------------------------------------------------------\n";
-  std::cout << "Final balance: $" << std::fixed << std::setprecision(0) << zoo_.getBalance()
-            << "\n";
-  std::cout << "Animals: " << zoo_.getAnimalCount() << "\n";
-  std::cout << "Zoo rating: " << std::fixed << std::setprecision(1) << rating << "/5.0\n";
-  std::cout << "----------------------------------------------------------------------\n\n";
+  screen_ << "\nGAME COMPLETE!\n";
+  screen_ << "----------------------------------------------------------------------\n";
+  screen_ << "Final balance: $" << Fixed{zoo_.getBalance(), 0} << "\n";
+  screen_ << "Animals: " << zoo_.getAnimalCount() << "\n";
+  screen_ << "Zoo rating: " << Fixed{rating, 1} << "/5.0\n";
+  screen_ << "----------------------------------------------------------------------\n\n";
 
-  std::cout << "PERFOMANCE REVIEW\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "PERFOMANCE REVIEW\n";
+  screen_ << "----------------------------------------------------------------------\n";
 
   // calculate overall score
   int score = 0;
 
   // financial health
   if (zoo_.getBalance() >= 2000) {
-    std::cout << "Excellent finances! (+3 points)\n";
+    screen_ << "Excellent finances! (+3 points)\n";
     score += 3;
   } else if (zoo_.getBalance() >= 1500) {
-    std::cout << "Strong finances! (+2 points)\n";
+    screen_ << "Strong finances! (+2 points)\n";
     score += 2;
   } else if (zoo_.getBalance() >= 1000) {
-    std::cout << "Financially stable! (+1 point)\n";
+    screen_ << "Financially stable! (+1 point)\n";
     score += 1;
   } else {
-    std::cout << "Poor finances. (+0 points)\n";
+    screen_ << "Poor finances. (+0 points)\n";
   }
 
   if (rating >= 4.5) {
-    std::cout << "Outstanding zoo! (+3 points)\n";
+    screen_ << "Outstanding zoo! (+3 points)\n";
     score += 3;
   } else if (rating >= 4.0) {
-    std::cout << "Excellent zoo! (+2 points)\n";
+    screen_ << "Excellent zoo! (+2 points)\n";
     score += 2;
   } else if (rating >= 3.5) {
-    std::cout << "Good zoo! (+1 point)\n";
+    screen_ << "Good zoo! (+1 point)\n";
     score += 1;
   } else if (rating >= 3.0) {
-    std::cout << "Acceptable zoo. (+0 points)\n";
+    screen_ << "Acceptable zoo. (+0 points)\n";
   } else {
-    std::cout << "Poor rating. (+0 points)\n";
+    screen_ << "Poor rating. (+0 points)\n";
   }
 
   // animal diversity
   int animal_count = zoo_.getAnimalCount();
   if (animal_count >= 6) {
-    std::cout << "Diverse zoo! (+2 points)\n";
+    screen_ << "Diverse zoo! (+2 points)\n";
     score += 2;
   } else if (animal_count >= 4) {
-    std::cout << "Good collection! (+1 point)\n";
+    screen_ << "Good collection! (+1 point)\n";
     score += 1;
   } else {
-    std::cout << "Small collection! (+0 points)\n";
+    screen_ << "Small collection! (+0 points)\n";
   }
 
   // animal welfare
-  auto needy_animals = zoo_.getAnimalsNeedingAttention();
-  if (needy_animals.empty()) {
-    std::cout << "All animals are healthy! (+2 points)\n";
+  auto needy_animals = std::ranges::distance(zoo_.animalsNeedingAttention());
+  if (needy_animals == 0) {
+    screen_ << "All animals are healthy! (+2 points)\n";
     score += 2;
-  } else if (needy_animals.size() < animal_count * 0.5) {
-    std::cout << "Most animals are healthy! (+1 point)\n";
+  } else if (needy_animals < animal_count * 0.5) {
+    screen_ << "Most animals are healthy! (+1 point)\n";
     score += 1;
   } else {
-    std::cout << "Many animals are being neglected! (+0 points)\n";
+    screen_ << "Many animals are being neglected! (+0 points)\n";
   }
 
-  std::cout << "FINAL SCORE: " << score << "/10\n\n";
+  screen_ << "FINAL SCORE: " << score << "/10\n\n";
 
   // victory messages
   if (score >= 9) {
-    std::cout << "Perfect Ending!\n";
-    std::cout << "You're a master zookeeper!\n";
+    screen_ << "Perfect Ending!\n";
+    screen_ << "You're a master zookeeper!\n";
   } else if (score >= 7) {
-    std::cout << "Excellent Ending!\n";
-    std::cout << "Your zoo is thriving!\n";
+    screen_ << "Excellent Ending!\n";
+    screen_ << "Your zoo is thriving!\n";
   } else if (score >= 5) {
-    std::cout << "Good Ending!\n";
-    std::cout << "You successfully managed the zoo!\n";
+    screen_ << "Good Ending!\n";
+    screen_ << "You successfully managed the zoo!\n";
   } else if (score >= 3) {
-    std::cout << "Survival Ending!\n";
-    std::cout << "You made it but barely!\n";
+    screen_ << "Survival Ending!\n";
+    screen_ << "You made it but barely!\n";
   } else {
-    std::cout << "Poor Ending!\n";
-    std::cout << "Your zoo is in terrible condition. The animals deserve better.\n";
+    screen_ << "Poor Ending!\n";
+    screen_ << "Your zoo is in terrible condition. The animals deserve better.\n";
   }
-  running_ = false;
-  return;
+  screen_.flush();
+  result_.score = score;
+  finishGame(GameOutcome::COMPLETED);
 }
 
 void Game::exitGame() {
-  std::cout << "  Exit game? (1 - Yes, 2 - No)\n";
+  out_ << "  Exit game? (1 - Yes, 2 - No)\n";
   int choice = getPlayerInput(1, 2);
 
   if (choice == 1) {
-    std::cout << "\nExiting game...\n";
-    std::cout << "Thanks for playing Zooperator " << player_.getName() << "!\n";
-    running_ = false;
+    leaveGame();
   }
 }
 
+void Game::leaveGame() {
+  out_ << "\nExiting game...\n";
+  out_ << "Thanks for playing Zooperator " << player_.getName() << "!\n";
+  finishGame(GameOutcome::QUIT);
+}
+
+void Game::finishGame(GameOutcome outcome) {
+  result_.outcome = outcome;
+  running_ = false;
+}
+
 void Game::displayHelp() {
-  std::cout << "\nHOW TO PLAY\n";
-  std::cout << "----------------------------------------------------------------------\n";
-  std::cout << "GOAL\n";
-  std::cout << " - Survive 10 days and complete all required missions!\n";
-  std::cout << " - Achieve the highest zoo rating possible!\n";
-  std::cout << "    - Based on animal happiness (50%), health (30%), cleanliness (15%), finances "
-               "(5%)\n\n";
-
-  std::cout << "GAME OVER CONDITIONS\n";
-  std::cout << "- Balance reaches $0\n";
-  std::cout << "- All animals die\n";
-  std::cout << "- Required mission becomes impossible\n\n";
-
-  std::cout << "MISSIONS\n";
-  std::cout << "- X means incomplete\n";
-  std::cout << "- ✓ means complete\n";
-  std::cout << "- ? means will be checked at end of day\n\n";
-
-  std::cout << "ACTIONS\n";
-  std::cout << " - Each action costs 1 action point (1 AP)\n";
-  std::cout << " - Start with 3/day, gain more with each animal/exhibit purchased\n";
-  std::cout << " - Action points reset daily\n";
-  std::cout << " - Feed ($): Reduces hunger, small happiness and energy boost\n";
-  std::cout << " - Play: Increases happiness, costs energy\n";
-  std::cout << " - Exercise: Increases health, costs energy\n";
-  std::cout << " - Treat ($50): Heals sick animals\n";
-  std::cout << " - Clean: Restores exhibit cleanliness to 100%\n\n";
-
-  std::cout << "ANIMAL STATS\n";
-  std::cout << "  - Health: Animals die if health becomes 0, treat sick animals\n";
-  std::cout << "  - Hunger: Feed regularly to prevent starvation\n";
-  std::cout << "  - Happiness: Affects zoo rating and health\n";
-  std::cout << "  - Energy: Needed for play/exercise activities\n";
-  std::cout << "  - All stats decline nightly, but sleep restores some energy/health\n\n";
-
-  std::cout << "HABITATS\n";
-  std::cout << "  - Animals prefer certain habitat types\n";
-  std::cout << "    - Grassland: Rabbit, Tortoise\n";
-  std::cout << "    - Forest: Bear\n";
-  std::cout << "    - Arctic: Penguin\n";
-  std::cout << "    - Jungle: Monkey\n";
-  std::cout << "    - Savanna: Lion, Elephant\n";
-  std::cout << "  - Correct habitat: +3 happiness/day\n";
-  std::cout << "  - Wrong habitat: -2 happiness/day\n";
-  std::cout << "  - No habitat: -15 happiness/day, -5 health/day\n\n";
-
-  std::cout << "TIPS:\n";
-  std::cout << "  - Check 'Animals Needing Attention' daily\n";
-  std::cout << "  - Complete optional missions for a bonus reward\n";
-  std::cout << "  - Neglected animals will die\n";
-  std::cout << "  - Unhappy animals reduce your zoo rating\n";
-  std::cout << "  - Homeless animals lose happiness/health daily\n";
-  std::cout << "  - Low rating = less visitors = less revenue\n";
-  std::cout << "  - Dirty exhibits drive visitors away\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen_ << "\nHOW TO PLAY\n";
+  screen_ << "----------------------------------------------------------------------\n";
+  screen_ << "GOAL\n";
+  screen_ << " - Survive " << mission_system_.getDayCount()
+          << " days and complete all required missions!\n";
+  screen_ << " - Achieve the highest zoo rating possible!\n";
+  screen_ << "    - Based on animal happiness (50%), health (30%), cleanliness (15%), finances "
+             "(5%)\n\n";
+
+  screen_ << "GAME OVER CONDITIONS\n";
+  screen_ << "- Balance reaches $0\n";
+  screen_ << "- All animals die\n";
+  screen_ << "- Required mission becomes impossible\n\n";
+
+  screen_ << "MISSIONS\n";
+  screen_ << "- X means incomplete\n";
+  screen_ << "- ✓ means complete\n";
+  screen_ << "- ? means will be checked at end of day\n\n";
+
+  screen_ << "ACTIONS\n";
+  screen_ << " - Each action costs 1 action point (1 AP)\n";
+  screen_ << " - Start with 3/day, gain more with each animal/exhibit purchased\n";
+  screen_ << " - Action points reset daily\n";
+  screen_ << " - Feed ($): Reduces hunger, small happiness and energy boost\n";
+  screen_ << " - Play: Increases happiness, costs energy\n";
+  screen_ << " - Exercise: Increases health, costs energy\n";
+  screen_ << " - Treat ($50): Heals sick animals\n";
+  screen_ << " - Clean: Restores exhibit cleanliness to 100%\n\n";
+
+  screen_ << "ANIMAL STATS\n";
+  screen_ << "  - Health: Animals die if health becomes 0, treat sick animals\n";
+  screen_ << "  - Hunger: Feed regularly to prevent starvation\n";
+  screen_ << "  - Happiness: Affects zoo rating and health\n";
+  screen_ << "  - Energy: Needed for play/exercise activities\n";
+  screen_ << "  - All stats decline nightly, but sleep restores some energy/health\n\n";
+
+  screen_ << "HABITATS\n";
+  screen_ << "  - Animals prefer certain habitat types\n";
+  screen_ << "    - Grassland: Rabbit, Tortoise\n";
+  screen_ << "    - Forest: Bear\n";
+  screen_ << "    - Arctic: Penguin\n";
+  screen_ << "    - Jungle: Monkey\n";
+  screen_ << "    - Savanna: Lion, Elephant\n";
+  screen_ << "  - Correct habitat: +3 happiness/day\n";
+  screen_ << "  - Wrong habitat: -2 happiness/day\n";
+  screen_ << "  - No habitat: -15 happiness/day, -5 health/day\n\n";
+
+  screen_ << "TIPS:\n";
+  screen_ << "  - Check 'Animals Needing Attention' daily\n";
+  screen_ << "  - Complete optional missions for a bonus reward\n";
+  screen_ << "  - Neglected animals will die\n";
+  screen_ << "  - Unhappy animals reduce your zoo rating\n";
+  screen_ << "  - Homeless animals lose happiness/health daily\n";
+  screen_ << "  - Low rating = less visitors = less revenue\n";
+  screen_ << "  - Dirty exhibits drive visitors away\n";
+  screen_ << "----------------------------------------------------------------------\n";
+  screen_.flush();
 }
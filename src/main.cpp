@@ -1,10 +1,90 @@
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
 
+#include "campaign.h"
 #include "game.h"
 #include "player.h"
+#include "rng.h"
+
+static void printUsage(const char* program) {
+  std::cerr << "usage: " << program << " [--seed <n>] [--campaign <file>]\n"
+            << "       " << program
+            << " [--seed <n>] [--campaign <file>] --script <file|-> [player name] [zoo name]\n";
+}
+
+// plays a command script instead of asking for input, "-" reads the script from stdin
+static int runScript(const char* path, const Player& player, const std::string& zoo_name,
+                     uint64_t seed, const Campaign& campaign) {
+  Game game(player, zoo_name, seed);
+  game.setCampaign(campaign);
+  if (std::strcmp(path, "-") == 0) {
+    return game.runScript(std::cin) ? 0 : 1;
+  }
+  std::ifstream script(path);
+  if (!script) {
+    std::cerr << "cannot open script " << path << "\n";
+    return 2;
+  }
+  return game.runScript(script) ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+  uint64_t seed = 0;
+  bool seeded = false;
+  const char* script_path = nullptr;
+  const char* campaign_path = nullptr;
+
+  int arg = 1;
+  for (; arg < argc; ++arg) {
+    std::string_view option = argv[arg];
+    if (option == "--seed" && arg + 1 < argc) {
+      std::string_view value = argv[++arg];
+      auto result = std::from_chars(value.data(), value.data() + value.size(), seed);
+      if (result.ec != std::errc() || result.ptr != value.data() + value.size()) {
+        std::cerr << "bad seed " << value << "\n";
+        return 2;
+      }
+      seeded = true;
+    } else if (option == "--script" && arg + 1 < argc) {
+      script_path = argv[++arg];
+    } else if (option == "--campaign" && arg + 1 < argc) {
+      campaign_path = argv[++arg];
+    } else if (option.starts_with("--")) {
+      printUsage(argv[0]);
+      return 2;
+    } else {
+      break;
+    }
+  }
+  if (!seeded) {
+    seed = randomSeed();
+  }
+
+  Campaign campaign;
+  if (campaign_path) {
+    std::string error;
+    if (!campaign.loadFile(campaign_path, error)) {
+      std::cerr << error << "\n";
+      return 2;
+    }
+  }
+  const Campaign& chosen = campaign_path ? campaign : standardCampaign();
+
+  if (script_path) {
+    Player player(arg < argc ? argv[arg] : "Player");
+    std::string zoo_name = arg + 1 < argc ? argv[arg + 1] : "Zoo";
+    return runScript(script_path, player, zoo_name, seed, chosen);
+  }
+  if (arg < argc) {
+    printUsage(argv[0]);
+    return 2;
+  }
 
-int main() {
   std::string player_name;
   do {
     std::cout << "> Hi! Please enter your name: ";
@@ -25,7 +105,8 @@ int main() {
     }
   } while (zoo_name.empty());
 
-  Game game(player, zoo_name);
+  Game game(player, zoo_name, seed);
+  game.setCampaign(chosen);
   game.start();
 
   return 0;
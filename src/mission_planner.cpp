@@ -0,0 +1,836 @@
+#include "mission_planner.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "animal_store.h"
+
+static constexpr double NO_PLAN = std::numeric_limits<double>::infinity();
+static constexpr double MONEY_SLACK = 0.005;  // for comparing sums of prices with the balance
+
+// Care sequences longer than this aren't searched. With more actions left, an animal that
+// isn't fixed by then is assumed fixed by one more, which can only make the answer lenient.
+static constexpr int MAX_CARE_STEPS = 4;
+
+// Bounds on the search with sales. Past MAX_TRACKED_SALES the care table only knows that many
+// animals or more were sold, and zoos with more ways of selling exhibits or that might need more
+// purchases than these are taken as feasible.
+static constexpr int MAX_TRACKED_SALES = 4;
+static constexpr size_t MAX_EXHIBIT_SALES = 64;
+static constexpr int MAX_PURCHASES = 8;
+
+// what caring for an animal adds towards the missions, besides fixing it
+static constexpr uint8_t GAIN_PLAYED = 1;
+static constexpr uint8_t GAIN_EXERCISED = 2;
+static constexpr uint8_t GAIN_STATES = 4;
+
+static constexpr size_t HABITAT_COUNT = HABITAT_TRAITS.size();
+
+// exhibits bought only for their number or their room are grassland, which is only right
+// while it is both the cheapest exhibit and the most room per dollar
+static constexpr bool grasslandIsCheapestRoom() {
+  const HabitatTraits& grassland = habitatTraits(Habitat::GRASSLAND);
+  for (size_t habitat = 1; habitat < HABITAT_COUNT; ++habitat) {
+    const HabitatTraits& traits = HABITAT_TRAITS[habitat];
+    if (traits.purchase_cost < grassland.purchase_cost ||
+        traits.max_capacity * grassland.purchase_cost >
+            grassland.max_capacity * traits.purchase_cost) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(grasslandIsCheapestRoom());
+
+// what the open required missions ask of the zoo by the end of the day
+struct Goals {
+  size_t animals = 0;
+  int species = 0;
+  size_t exhibits = 0;
+  std::array<SpeciesMask, 3> any_of{};  // own a species from each non-zero mask
+  bool housed_one = false;
+  bool no_homeless = false;
+  bool preferred = false;
+  int feeds = 0;  // more animals to feed
+  uint8_t gains = 0;
+  bool no_neglected = false;
+  bool no_sick = false;
+  int cleans = 0;  // more exhibits to clean
+  int min_cleanliness = 0;
+};
+
+// false when a mission can already never be met
+static bool collectGoals(std::span<const Mission> missions, const DayProgress& progress,
+                         Goals& goals) {
+  int fed = static_cast<int>(progress.fed.size());
+  int cleaned = static_cast<int>(progress.cleaned.size());
+  for (const Mission& mission : missions) {
+    if (!mission.required || mission.completed || mission.predicate) {
+      continue;
+    }
+
+    size_t count = static_cast<size_t>(std::max(mission.int_param, 0));
+    switch (mission.type) {
+      case MissionType::ADD_ANIMAL_TO_EXHIBIT:
+        goals.housed_one = true;
+        goals.animals = std::max<size_t>(goals.animals, 1);
+        break;
+      case MissionType::OWN_X_ANIMALS:
+        goals.animals = std::max(goals.animals, count);
+        break;
+      case MissionType::OWN_X_SPECIES:
+        goals.species = std::max(goals.species, mission.int_param);
+        break;
+      case MissionType::OWN_X_EXHIBITS:
+        goals.exhibits = std::max(goals.exhibits, count);
+        break;
+      case MissionType::FEED_X_ANIMALS:
+        // the fed count only grows, once past the target it never equals it again
+        if (fed > mission.int_param) {
+          return false;
+        }
+        goals.feeds = std::max(goals.feeds, mission.int_param - fed);
+        break;
+      case MissionType::PLAY_WITH_ANIMAL:
+        goals.gains |= progress.played ? 0 : GAIN_PLAYED;
+        break;
+      case MissionType::EXERCISE_ANIMAL:
+        goals.gains |= progress.exercised ? 0 : GAIN_EXERCISED;
+        break;
+      case MissionType::NO_ANIMALS_NEED_ATTENTION:
+        goals.no_neglected = true;
+        break;
+      case MissionType::NO_SICK_ANIMALS:
+        goals.no_sick = true;
+        break;
+      case MissionType::NO_HOMELESS_ANIMALS:
+        goals.no_homeless = true;
+        break;
+      case MissionType::PREFERRED_HABITATS:
+        goals.preferred = true;
+        break;
+      case MissionType::CLEAN_X_EXHIBITS:
+        goals.cleans = std::max(goals.cleans, mission.int_param - cleaned);
+        break;
+      case MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X:
+        goals.min_cleanliness = std::max(goals.min_cleanliness, mission.int_param);
+        break;
+      case MissionType::OWN_ELEPHANT:
+        goals.any_of[0] = speciesBit(Species::ELEPHANT);
+        break;
+      case MissionType::OWN_MEDIUM_ANIMAL:
+        goals.any_of[1] = MEDIUM_SPECIES;
+        break;
+      case MissionType::OWN_SPECIAL_ANIMAL:
+        goals.any_of[2] = SPECIAL_SPECIES;
+        break;
+      default:
+        // money, rating and visitor targets depend on the night's numbers, not modeled
+        break;
+    }
+  }
+  return true;
+}
+
+// what an exhibit needs for the cleanliness goal if it's kept
+enum class Upkeep : uint8_t {
+  KEEP,
+  CLEAN,  // one action to clean it
+  SELL,   // too clean to be cleaned, too dirty to pass
+};
+
+// exhibits alike in everything the plan looks at
+struct ExhibitGroup {
+  Habitat habitat;
+  int capacity;
+  double sale_price;
+  Upkeep upkeep;
+  int count;
+};
+
+struct ExhibitSurvey {
+  std::vector<ExhibitGroup> groups;
+  int cleanable = 0;
+};
+
+static ExhibitSurvey surveyExhibits(const Zoo& zoo, const Goals& goals) {
+  ExhibitSurvey survey;
+  for (const Exhibit* exhibit : zoo.exhibitView()) {
+    int level = exhibit->getCleanliness();
+    bool cleanable = level <= Exhibit::CLEANABLE_AT_MOST;
+    survey.cleanable += cleanable;
+    Upkeep upkeep = Upkeep::KEEP;
+    if (level < goals.min_cleanliness) {
+      upkeep = cleanable ? Upkeep::CLEAN : Upkeep::SELL;
+    }
+    ExhibitGroup group{exhibit->getHabitat(), exhibit->getMaxCapacity(),
+                       exhibit->getPurchaseCost() / 2.0, upkeep, 1};
+    auto same = std::ranges::find_if(survey.groups, [&](const ExhibitGroup& other) {
+      return other.habitat == group.habitat && other.capacity == group.capacity &&
+             other.sale_price == group.sale_price && other.upkeep == group.upkeep;
+    });
+    if (same == survey.groups.end()) {
+      survey.groups.push_back(group);
+    } else {
+      same->count++;
+    }
+  }
+  return survey;
+}
+
+// one way of selling some of the zoo's exhibits
+struct ExhibitSale {
+  double money = 0.0;
+  int sold = 0;
+  std::array<int, HABITAT_COUNT> capacity{};  // places in the kept exhibits, by habitat
+  int cleaning = 0;                           // actions the cleaning goals take
+};
+
+// Every way of selling the exhibits, by how many of each group go. Without sales that's only
+// selling none, or no way at all when an exhibit can't stay. False when there are more than
+// MAX_EXHIBIT_SALES ways to search.
+static bool exhibitSales(const ExhibitSurvey& survey, const Goals& goals, bool sales,
+                         std::vector<ExhibitSale>& out) {
+  out.clear();
+  std::vector<int> sold(survey.groups.size(), 0);
+  size_t ways = 1;
+  for (size_t group = 0; group < survey.groups.size(); ++group) {
+    const ExhibitGroup& exhibits = survey.groups[group];
+    if (exhibits.upkeep == Upkeep::SELL) {
+      if (!sales) {
+        return true;
+      }
+      sold[group] = exhibits.count;
+    } else if (sales) {
+      ways *= static_cast<size_t>(exhibits.count) + 1;
+      if (ways > MAX_EXHIBIT_SALES) {
+        return false;
+      }
+    }
+  }
+
+  while (true) {
+    ExhibitSale sale;
+    int dirty = 0;
+    for (size_t group = 0; group < survey.groups.size(); ++group) {
+      const ExhibitGroup& exhibits = survey.groups[group];
+      int kept = exhibits.count - sold[group];
+      sale.money += sold[group] * exhibits.sale_price;
+      sale.sold += sold[group];
+      sale.capacity[static_cast<size_t>(exhibits.habitat)] += kept * exhibits.capacity;
+      dirty += exhibits.upkeep == Upkeep::CLEAN ? kept : 0;
+    }
+    // sold exhibits still count towards the cleaning goal once cleaned
+    sale.cleaning = std::max(goals.cleans, dirty);
+    out.push_back(sale);
+
+    // the next way, counting up through the groups that may be kept
+    size_t group = 0;
+    for (; group < survey.groups.size(); ++group) {
+      if (!sales || survey.groups[group].upkeep == Upkeep::SELL) {
+        continue;
+      }
+      if (sold[group] < survey.groups[group].count) {
+        sold[group]++;
+        break;
+      }
+      sold[group] = 0;
+    }
+    if (group == survey.groups.size()) {
+      return true;
+    }
+  }
+}
+
+// the zoo's animals, by the habitat they belong in
+static std::array<int, HABITAT_COUNT> animalsByHabitat(const Zoo& zoo) {
+  std::array<int, HABITAT_COUNT> animals{};
+  for (const Animal* animal : zoo.animalView()) {
+    animals[static_cast<size_t>(animal->getHabitat())]++;
+  }
+  return animals;
+}
+
+// one way of caring for an animal that leaves it fit for the missions
+struct CareOption {
+  int actions;
+  double cost;  // below zero when the animal is sold for more than its care costs
+  int fed;      // 1 when the animal counts towards today's feeding
+  uint8_t gains;
+  int sold;  // 1 when the animal is sold once cared for
+};
+
+using CareStats = std::array<int, ANIMAL_STAT_COUNT>;
+
+// Searches the care sequences for one animal, keeping the cheapest per outcome. With a sale
+// price, the animal may also be sold after any of them; a sold animal needn't be fit, and what
+// it was fed or played with still counts.
+class CareSearch {
+ public:
+  CareSearch(const Goals& goals, double feeding_cost, bool counts_feed, int max_steps,
+             std::optional<double> sale_price)
+      : goals_(goals),
+        feeding_cost_(feeding_cost),
+        counts_feed_(counts_feed && goals.feeds > 0),
+        max_steps_(max_steps),
+        sale_price_(sale_price) {
+    for (auto& by_sold : cheapest_) {
+      for (auto& by_fed : by_sold) {
+        for (auto& by_gains : by_fed) {
+          by_gains.fill(NO_PLAN);
+        }
+      }
+    }
+  }
+
+  void run(const CareStats& stats) {
+    visit(stats, 0, 0.0, 0, 0);
+  }
+
+  // counts as one more step than searched, at no cost and with everything it could gain
+  void assumeFixedLater() {
+    record(max_steps_ + 1, 0.0, counts_feed_ ? 1 : 0, goals_.gains, 0);
+    if (sale_price_) {
+      record(max_steps_ + 1, -*sale_price_, counts_feed_ ? 1 : 0, goals_.gains, 1);
+    }
+  }
+
+  // the options no other option beats on actions, cost, feeding and gains at once
+  void options(std::vector<CareOption>& out) const {
+    out.clear();
+    for (int steps = 0; steps <= max_steps_ + 1; ++steps) {
+      for (int sold = 0; sold < 2; ++sold) {
+        for (int fed = 0; fed < 2; ++fed) {
+          for (uint8_t gains = 0; gains < GAIN_STATES; ++gains) {
+            double cost = cheapest_[steps][sold][fed][gains];
+            if (cost == NO_PLAN) {
+              continue;
+            }
+            // keeping and selling are never compared, each is better for some goals
+            CareOption option{steps, cost, fed, gains, sold};
+            bool beaten = std::ranges::any_of(out, [&](const CareOption& other) {
+              return other.sold == option.sold && other.actions <= option.actions &&
+                     other.cost <= option.cost && other.fed >= option.fed &&
+                     (other.gains & option.gains) == option.gains;
+            });
+            if (!beaten) {
+              out.push_back(option);
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  void visit(const CareStats& stats, int steps, double cost, int fed, uint8_t gains) {
+    if (fit(stats)) {
+      record(steps, cost, fed, gains, 0);
+    }
+    if (sale_price_) {
+      record(steps, cost - *sale_price_, fed, gains, 1);
+    }
+    if (steps == max_steps_ || stats[static_cast<size_t>(AnimalStat::HEALTH)] <= 0) {
+      return;
+    }
+
+    for (size_t care = 0; care < CARE_COUNT; ++care) {
+      const CareEffect& effect = CARE_EFFECTS[care];
+      if (stats[static_cast<size_t>(AnimalStat::ENERGY)] < effect.min_energy) {
+        continue;
+      }
+      CareStats next = stats;
+      apply(next, AnimalStat::HEALTH, effect.health);
+      apply(next, AnimalStat::HUNGER, effect.hunger);
+      apply(next, AnimalStat::HAPPINESS, effect.happiness);
+      apply(next, AnimalStat::ENERGY, effect.energy);
+
+      double next_cost = cost;
+      int next_fed = fed;
+      uint8_t next_gains = gains;
+      switch (static_cast<Care>(care)) {
+        case Care::FEED:
+          next_cost += feeding_cost_;
+          next_fed |= counts_feed_ ? 1 : 0;
+          break;
+        case Care::PLAY:
+          next_gains |= goals_.gains & GAIN_PLAYED;
+          break;
+        case Care::EXERCISE:
+          next_gains |= goals_.gains & GAIN_EXERCISED;
+          break;
+        case Care::TREAT:
+          next_cost += TREATMENT_COST;
+          break;
+      }
+      visit(next, steps + 1, next_cost, next_fed, next_gains);
+    }
+  }
+
+  bool fit(const CareStats& stats) const {
+    uint8_t flags = AnimalStore::thresholdFlags(stats[static_cast<size_t>(AnimalStat::HEALTH)],
+                                                stats[static_cast<size_t>(AnimalStat::HUNGER)],
+                                                stats[static_cast<size_t>(AnimalStat::HAPPINESS)],
+                                                stats[static_cast<size_t>(AnimalStat::ENERGY)]);
+    return !(goals_.no_sick && (flags & AnimalStore::SICK)) &&
+           !(goals_.no_neglected && (flags & AnimalStore::NEGLECTED));
+  }
+
+  static void apply(CareStats& stats, AnimalStat stat, int delta) {
+    int& value = stats[static_cast<size_t>(stat)];
+    value = std::clamp(value + delta, Animal::MIN_STAT, Animal::MAX_STAT);
+  }
+
+  void record(int steps, double cost, int fed, uint8_t gains, int sold) {
+    double& cheapest = cheapest_[steps][sold][fed][gains];
+    cheapest = std::min(cheapest, cost);
+  }
+
+  const Goals& goals_;
+  double feeding_cost_;
+  bool counts_feed_;
+  int max_steps_;
+  std::optional<double> sale_price_;
+  // by steps, sold, fed and gains
+  std::array<std::array<std::array<std::array<double, GAIN_STATES>, 2>, 2>, MAX_CARE_STEPS + 2>
+      cheapest_;
+};
+
+// The least money that reaches each (actions spent, animals fed, gains, animals sold) state,
+// built up one animal at a time. Feeding past the goal is counted as the goal, and selling past
+// `sales` animals as that many. Money made by selling makes a state's money negative.
+class CareTable {
+ public:
+  CareTable(int actions, int feeds, int sales)
+      : actions_(actions),
+        feeds_(feeds),
+        sales_(sales),
+        money_(stateCount(), NO_PLAN),
+        next_(stateCount()) {
+    at(0, 0, 0, 0) = 0.0;
+  }
+
+  void add(std::span<const CareOption> options) {
+    std::ranges::fill(next_, NO_PLAN);
+    for (int actions = 0; actions <= actions_; ++actions) {
+      for (int fed = 0; fed <= feeds_; ++fed) {
+        for (uint8_t gains = 0; gains < GAIN_STATES; ++gains) {
+          for (int sold = 0; sold <= sales_; ++sold) {
+            double money = at(actions, fed, gains, sold);
+            if (money == NO_PLAN) {
+              continue;
+            }
+            for (const CareOption& option : options) {
+              if (actions + option.actions > actions_) {
+                continue;
+              }
+              double& slot =
+                  next_[index(actions + option.actions, std::min(feeds_, fed + option.fed),
+                              gains | option.gains, std::min(sales_, sold + option.sold))];
+              slot = std::min(slot, money + option.cost);
+            }
+          }
+        }
+      }
+    }
+    std::swap(money_, next_);
+  }
+
+  // turns each state into the least money within that many actions
+  void spreadOverActions() {
+    for (int actions = 1; actions <= actions_; ++actions) {
+      for (int fed = 0; fed <= feeds_; ++fed) {
+        for (uint8_t gains = 0; gains < GAIN_STATES; ++gains) {
+          for (int sold = 0; sold <= sales_; ++sold) {
+            at(actions, fed, gains, sold) =
+                std::min(at(actions, fed, gains, sold), at(actions - 1, fed, gains, sold));
+          }
+        }
+      }
+    }
+  }
+
+  double at(int actions, int fed, uint8_t gains, int sold) const {
+    return money_[index(actions, fed, gains, sold)];
+  }
+
+  int sales() const {
+    return sales_;
+  }
+
+ private:
+  size_t stateCount() const {
+    return static_cast<size_t>(actions_ + 1) * static_cast<size_t>(feeds_ + 1) * GAIN_STATES *
+           static_cast<size_t>(sales_ + 1);
+  }
+
+  size_t index(int actions, int fed, uint8_t gains, int sold) const {
+    size_t state = (static_cast<size_t>(actions) * static_cast<size_t>(feeds_ + 1) +
+                    static_cast<size_t>(fed)) * GAIN_STATES + gains;
+    return state * static_cast<size_t>(sales_ + 1) + static_cast<size_t>(sold);
+  }
+
+  double& at(int actions, int fed, uint8_t gains, int sold) {
+    return money_[index(actions, fed, gains, sold)];
+  }
+
+  int actions_;
+  int feeds_;
+  int sales_;
+  std::vector<double> money_;
+  std::vector<double> next_;
+};
+
+// species indices, cheapest to feed first
+static constexpr std::array<size_t, SPECIES_COUNT> BY_FEEDING_COST = [] {
+  std::array<size_t, SPECIES_COUNT> order{};
+  for (size_t species = 0; species < SPECIES_COUNT; ++species) {
+    order[species] = species;
+  }
+  std::ranges::sort(order, {}, [](size_t species) { return SPECIES_TRAITS[species].feeding_cost; });
+  return order;
+}();
+
+// animals bought today, counted by species
+struct Purchase {
+  std::array<int, SPECIES_COUNT> count{};
+  int animals = 0;
+  SpeciesMask species = 0;
+  double cost = 0.0;
+};
+
+// Searches what to buy on top of the care table and exhibit sales, stopping at the first plan
+// that fits. With `capped`, max_animals is below what a plan might need, and reaching it with
+// money left to buy more counts as a plan.
+class PurchaseSearch {
+ public:
+  PurchaseSearch(const MissionContext& context, const Goals& goals,
+                 const std::array<int, HABITAT_COUNT>& animals,
+                 std::span<const ExhibitSale> exhibit_sales, const CareTable& care,
+                 int action_points, int max_per_species, int max_animals, bool capped,
+                 double sale_money)
+      : context_(context),
+        goals_(goals),
+        animals_(animals),
+        exhibit_sales_(exhibit_sales),
+        care_(care),
+        action_points_(action_points),
+        max_per_species_(max_per_species),
+        max_animals_(max_animals),
+        capped_(capped),
+        sale_money_(sale_money) {}
+
+  bool run() {
+    Purchase purchase;
+    return visit(0, purchase);
+  }
+
+ private:
+  bool visit(size_t species, Purchase& purchase) {
+    if (!affordable(purchase.cost)) {
+      return false;
+    }
+    if (species == SPECIES_COUNT) {
+      return fits(purchase);
+    }
+
+    const SpeciesTraits& traits = SPECIES_TRAITS[species];
+    SpeciesMask bit = speciesBit(static_cast<Species>(species));
+    SpeciesMask owned = purchase.species;
+    for (int count = 0; count <= max_per_species_; ++count) {
+      if (count > 0) {
+        if (purchase.animals == max_animals_) {
+          if (capped_ && affordable(purchase.cost + traits.purchase_cost)) {
+            return true;  // too many purchases to search
+          }
+          break;
+        }
+        purchase.count[species]++;
+        purchase.animals++;
+        purchase.species |= bit;
+        purchase.cost += traits.purchase_cost;
+      }
+      if (visit(species + 1, purchase)) {
+        return true;
+      }
+    }
+    int bought = purchase.count[species];
+    purchase.count[species] = 0;
+    purchase.animals -= bought;
+    purchase.species = owned;
+    purchase.cost -= bought * traits.purchase_cost;
+    return false;
+  }
+
+  // with everything sold
+  bool affordable(double cost) const {
+    return cost <= context_.balance + sale_money_ + MONEY_SLACK;
+  }
+
+  bool fits(const Purchase& purchase) const {
+    for (const ExhibitSale& sale : exhibit_sales_) {
+      int actions = action_points_ - sale.cleaning;
+      if (actions < 0) {
+        continue;
+      }
+      for (int sold = 0; sold <= care_.sales(); ++sold) {
+        if (fitsSelling(purchase, sale, actions, sold)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // The sold animals are taken to be the ones that matter least: a species is only lost once
+  // every other animal has gone, and any animal can be the one that no longer needs a place.
+  // The top sales state is taken as that many for the goals and as all of them for housing.
+  bool fitsSelling(const Purchase& purchase, const ExhibitSale& sale, int actions, int sold) const {
+    int owned_animals = static_cast<int>(context_.animals);
+    if (owned_animals - sold + purchase.animals < static_cast<int>(goals_.animals)) {
+      return false;
+    }
+    int lost = std::max(sold - (owned_animals - speciesMaskCount(context_.species)), 0);
+    int rebought = speciesMaskCount(context_.species & purchase.species);
+    int species =
+        speciesMaskCount(context_.species | purchase.species) - std::max(lost - rebought, 0);
+    if (species < goals_.species) {
+      return false;
+    }
+    SpeciesMask owned =
+        sold == owned_animals ? purchase.species : context_.species | purchase.species;
+    for (SpeciesMask mask : goals_.any_of) {
+      if (mask != 0 && (owned & mask) == 0) {
+        return false;
+      }
+    }
+
+    // what selling animals brings is in the care table
+    int most_sold = sold > 0 && sold == care_.sales() ? owned_animals : sold;
+    double money =
+        context_.balance + sale.money - purchase.cost - exhibitCost(purchase, sale, most_sold);
+    return careFits(purchase, money, actions, sold);
+  }
+
+  // the exhibits for every animal in one of its own habitat, with up to `sold` of the animals
+  // already owned not needing one
+  double preferredCost(const std::array<int, HABITAT_COUNT>& arriving,
+                       const std::array<int, HABITAT_COUNT>& capacity, int sold,
+                       int& bought) const {
+    std::vector<double> cheapest(static_cast<size_t>(sold) + 1, NO_PLAN);
+    std::vector<double> next(cheapest.size());
+    cheapest[0] = 0.0;
+    bought = 0;
+    for (size_t habitat = 1; habitat < HABITAT_COUNT; ++habitat) {
+      const HabitatTraits& traits = HABITAT_TRAITS[habitat];
+      auto exhibits = [&](int gone) {
+        int short_by = arriving[habitat] - gone - capacity[habitat];
+        return short_by > 0 ? (short_by + traits.max_capacity - 1) / traits.max_capacity : 0;
+      };
+      // without sales, which buys the most exhibits towards the exhibit goal
+      bought += exhibits(0);
+
+      std::ranges::fill(next, NO_PLAN);
+      for (int gone = 0; gone <= sold; ++gone) {
+        if (cheapest[static_cast<size_t>(gone)] == NO_PLAN) {
+          continue;
+        }
+        int most = std::min(sold - gone, animals_[habitat]);
+        for (int more = 0; more <= most; ++more) {
+          double& slot = next[static_cast<size_t>(gone + more)];
+          slot = std::min(slot, cheapest[static_cast<size_t>(gone)] +
+                                    exhibits(more) * traits.purchase_cost);
+        }
+      }
+      std::swap(cheapest, next);
+    }
+    return std::ranges::min(cheapest);
+  }
+
+  // the least the exhibits the housing and exhibit goals still need cost, animals move between
+  // exhibits for free
+  double exhibitCost(const Purchase& purchase, const ExhibitSale& sale, int sold) const {
+    std::array<int, HABITAT_COUNT> arriving = animals_;
+    for (size_t species = 0; species < SPECIES_COUNT; ++species) {
+      arriving[static_cast<size_t>(SPECIES_TRAITS[species].habitat)] += purchase.count[species];
+    }
+
+    double cost = 0.0;
+    int bought = 0;
+    int room_short = 0;
+    if (goals_.preferred) {
+      // every animal in an exhibit of its own habitat, which also houses them all
+      cost = preferredCost(arriving, sale.capacity, sold, bought);
+    } else {
+      int room = std::accumulate(sale.capacity.begin(), sale.capacity.end(), 0);
+      if (goals_.no_homeless) {
+        room_short = static_cast<int>(context_.animals) + purchase.animals - sold - room;
+      }
+      if (goals_.housed_one) {
+        room_short = std::max(room_short, 1 - room);
+      }
+    }
+
+    const HabitatTraits& grassland = habitatTraits(Habitat::GRASSLAND);
+    int count_short = static_cast<int>(goals_.exhibits) - static_cast<int>(context_.exhibits) +
+                      sale.sold - bought;
+    int extra = std::max({0, count_short,
+                          (room_short + grassland.max_capacity - 1) / grassland.max_capacity});
+    return cost + extra * grassland.purchase_cost;
+  }
+
+  // the cheapest way to feed `animals` of the new animals
+  static double newFeeding(const Purchase& purchase, int animals) {
+    double cost = 0.0;
+    for (size_t species : BY_FEEDING_COST) {
+      int fed = std::min(animals, purchase.count[species]);
+      cost += fed * SPECIES_TRAITS[species].feeding_cost;
+      animals -= fed;
+    }
+    return animals == 0 ? cost : NO_PLAN;
+  }
+
+  // new animals arrive healthy and unfed, so they can take any care
+  bool careFits(const Purchase& purchase, double money, int actions, int sold) const {
+    for (int fed = 0; fed <= goals_.feeds; ++fed) {
+      int from_new = goals_.feeds - fed;
+      double new_feeding = newFeeding(purchase, from_new);
+      if (new_feeding == NO_PLAN) {
+        continue;
+      }
+      for (uint8_t gains = 0; gains < GAIN_STATES; ++gains) {
+        uint8_t missing = goals_.gains & ~gains;
+        if (missing != 0 && purchase.animals == 0) {
+          continue;
+        }
+        int spent = from_new + std::popcount(missing);
+        if (spent > actions) {
+          continue;
+        }
+        if (care_.at(actions - spent, fed, gains, sold) + new_feeding <= money + MONEY_SLACK) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  const MissionContext& context_;
+  const Goals& goals_;
+  const std::array<int, HABITAT_COUNT>& animals_;
+  std::span<const ExhibitSale> exhibit_sales_;
+  const CareTable& care_;
+  int action_points_;
+  int max_per_species_;
+  int max_animals_;
+  bool capped_;
+  double sale_money_;
+};
+
+// the search for one set of goals over the given exhibit sales, with or without selling the
+// zoo's animals
+static bool feasible(const Zoo& zoo, const MissionContext& context, const Goals& goals,
+                     const DayProgress& progress, std::span<const ExhibitSale> exhibit_sales,
+                     int action_points, bool sales) {
+  if (exhibit_sales.empty()) {
+    return false;
+  }
+  // the table covers the most actions any exhibit sale leaves for care
+  int cleaning = std::ranges::min(exhibit_sales, {}, &ExhibitSale::cleaning).cleaning;
+  int actions = action_points - cleaning;
+  if (actions < 0) {
+    return false;
+  }
+
+  int sellable = sales ? std::min(static_cast<int>(context.animals), MAX_TRACKED_SALES) : 0;
+  CareTable care(actions, goals.feeds, sellable);
+  bool cares = goals.no_neglected || goals.no_sick || goals.feeds > 0 || goals.gains != 0 || sales;
+  int unfed = 0;
+  double sale_money = std::ranges::max(exhibit_sales, {}, &ExhibitSale::money).money;
+  std::vector<CareOption> options;
+  for (const Animal* animal : zoo.animalView()) {
+    bool counts_feed = !progress.fed.contains(animal->getId());
+    unfed += counts_feed && animal->isAlive();
+    if (!cares) {
+      continue;
+    }
+
+    std::optional<double> sale_price;
+    if (sales) {
+      sale_price = animal->getPurchaseCost() / 2.0;
+      sale_money += *sale_price;
+    }
+    int steps = std::min(actions, MAX_CARE_STEPS);
+    CareSearch search(goals, animal->getFeedingCost(), counts_feed, steps, sale_price);
+    search.run({animal->getHealthLevel(), animal->getHungerLevel(), animal->getHappinessLevel(),
+                animal->getEnergyLevel()});
+    if (actions > steps && animal->isAlive()) {
+      search.assumeFixedLater();
+    }
+    search.options(options);
+    if (options.empty()) {
+      return false;
+    }
+    if (options.size() > 1 || options[0].actions > 0 || options[0].cost != 0.0 ||
+        options[0].sold > 0) {
+      care.add(options);
+    }
+  }
+  care.spreadOverActions();
+
+  // Animals are worth buying for their number, their species, a first home or to take care
+  // nothing else can. Feeding any animal costs less than buying one, so bought animals only
+  // make up for too few unfed ones.
+  int more = std::max({static_cast<int>(goals.animals) - static_cast<int>(context.animals),
+                       goals.feeds - unfed, 0});
+  int groups = static_cast<int>(std::ranges::count_if(goals.any_of, std::identity{}));
+  std::array<int, HABITAT_COUNT> animals = animalsByHabitat(zoo);
+  if (!sales) {
+    int species_short = std::max(goals.species - speciesMaskCount(context.species), 0);
+    return PurchaseSearch(context, goals, animals, exhibit_sales, care, action_points,
+                          std::max(more, 1), more + species_short + groups + 1, false, sale_money)
+        .run();
+  }
+
+  // With sales, each bought animal a plan needs serves the animal count, a feeding, a species,
+  // a group or a gain, so no plan needs more than that.
+  int needed = static_cast<int>(goals.animals) + std::max(goals.feeds - unfed, 0) +
+               goals.species + groups + std::popcount(goals.gains);
+  int max_animals = std::min(needed, MAX_PURCHASES);
+  return PurchaseSearch(context, goals, animals, exhibit_sales, care, action_points, max_animals,
+                        max_animals, needed > MAX_PURCHASES, sale_money)
+      .run();
+}
+
+bool requiredMissionsFeasible(const Zoo& zoo, const MissionContext& context,
+                              std::span<const Mission> missions, const DayProgress& progress,
+                              int action_points) {
+  Goals goals;
+  if (!collectGoals(missions, progress, goals)) {
+    return false;
+  }
+
+  // exhibits bought today are spotless, so they can't be cleaned either, and every feeding,
+  // cleaning and gain takes an action of its own
+  action_points = std::max(action_points, 0);
+  ExhibitSurvey survey = surveyExhibits(zoo, goals);
+  if (goals.cleans > survey.cleanable ||
+      goals.cleans + goals.feeds + std::popcount(goals.gains) > action_points) {
+    return false;
+  }
+
+  // selling widens the search a lot, and most days are met without it
+  std::vector<ExhibitSale> exhibit_sales;
+  exhibitSales(survey, goals, false, exhibit_sales);
+  if (feasible(zoo, context, goals, progress, exhibit_sales, action_points, false)) {
+    return true;
+  }
+  if (!exhibitSales(survey, goals, true, exhibit_sales)) {
+    return true;  // too many ways of selling exhibits to search
+  }
+  return feasible(zoo, context, goals, progress, exhibit_sales, action_points, true);
+}
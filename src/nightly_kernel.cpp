@@ -0,0 +1,368 @@
+#include "nightly_kernel.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ZOO_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define ZOO_X86_KERNELS 0
+#endif
+
+static int clampStat(int value) {
+  return std::max(KERNEL_MIN_STAT, std::min(value, KERNEL_MAX_STAT));
+}
+
+// the reference implementation, also used for the lanes left over by the vector paths
+static void nightlyScalar(const NightlyLanes& lanes, size_t begin) {
+  int* health = lanes.health;
+  int* hunger = lanes.hunger;
+  int* happiness = lanes.happiness;
+  int* energy = lanes.energy;
+
+  for (size_t i = begin; i < lanes.count; ++i) {
+    const DailyDecay& decay = speciesTraits(lanes.species[i]).decay;
+
+    // daily decay
+    hunger[i] = clampStat(hunger[i] + decay.hunger);
+    happiness[i] = clampStat(happiness[i] + decay.happiness);
+    energy[i] = clampStat(energy[i] + decay.energy);
+
+    // decline health due to starvation
+    if (hunger[i] >= 90) {
+      health[i] = clampStat(health[i] - 30);
+    } else if (hunger[i] >= 75) {
+      health[i] = clampStat(health[i] - 20);
+    } else if (hunger[i] >= 60) {
+      health[i] = clampStat(health[i] - 15);
+    } else if (hunger[i] >= 45) {
+      health[i] = clampStat(health[i] - 5);
+    }
+
+    // decline health due to unhappiness
+    if (happiness[i] < 20) {
+      health[i] = clampStat(health[i] - 15);
+    } else if (happiness[i] < 40) {
+      health[i] = clampStat(health[i] - 5);
+    } else if (happiness[i] < 60) {
+      health[i] = clampStat(health[i] - 2);
+    }
+
+    // decline health due to exhaustion
+    if (energy[i] < 20) {
+      health[i] = clampStat(health[i] - 10);
+    } else if (energy[i] < 40) {
+      health[i] = clampStat(health[i] - 5);
+    }
+
+    switch (lanes.placement[i]) {
+      case Placement::HOMELESS:
+        // happiness penalty for homeless animals
+        happiness[i] = clampStat(happiness[i] - 15);
+        health[i] = clampStat(health[i] - 5);
+        break;
+      case Placement::PREFERRED_HABITAT:
+        // habitat matching happiness bonus
+        happiness[i] = clampStat(happiness[i] + 3);
+        break;
+      case Placement::OTHER_HABITAT:
+        happiness[i] = clampStat(happiness[i] - 2);
+        break;
+    }
+
+    // nightly recovery
+    energy[i] = clampStat(energy[i] + 8);
+    health[i] = clampStat(health[i] + 1);
+    hunger[i] = clampStat(hunger[i] + 8);
+  }
+}
+
+#if ZOO_X86_KERNELS
+
+// species decay as lookup tables: 8 x int32 for vpermd, 16 x int8 for pshufb
+template <typename T, size_t N>
+static constexpr std::array<T, N> decayTable(int DailyDecay::*field) {
+  std::array<T, N> table{};
+  for (size_t i = 0; i < SPECIES_COUNT; ++i) {
+    table[i] = static_cast<T>(SPECIES_TRAITS[i].decay.*field);
+  }
+  return table;
+}
+
+static_assert(SPECIES_COUNT <= 8, "vpermd decay lookup holds at most 8 species");
+
+alignas(32) static constexpr auto HUNGER_DECAY32 = decayTable<int32_t, 8>(&DailyDecay::hunger);
+alignas(32) static constexpr auto HAPPINESS_DECAY32 =
+    decayTable<int32_t, 8>(&DailyDecay::happiness);
+alignas(32) static constexpr auto ENERGY_DECAY32 = decayTable<int32_t, 8>(&DailyDecay::energy);
+alignas(16) static constexpr auto HUNGER_DECAY8 = decayTable<int8_t, 16>(&DailyDecay::hunger);
+alignas(16) static constexpr auto HAPPINESS_DECAY8 = decayTable<int8_t, 16>(&DailyDecay::happiness);
+alignas(16) static constexpr auto ENERGY_DECAY8 = decayTable<int8_t, 16>(&DailyDecay::energy);
+
+// placement bytes widened to 32-bit lanes
+static constexpr int HOMELESS_LANE = static_cast<int>(Placement::HOMELESS);
+static constexpr int PREFERRED_LANE = static_cast<int>(Placement::PREFERRED_HABITAT);
+static constexpr int OTHER_LANE = static_cast<int>(Placement::OTHER_HABITAT);
+
+// AVX2, 8 lanes per step
+
+#define ZOO_AVX2 __attribute__((target("avx2")))
+
+ZOO_AVX2 static inline __m256i splat8(int value) {
+  return _mm256_set1_epi32(value);
+}
+
+// value where mask is set, zero elsewhere
+ZOO_AVX2 static inline __m256i select8(__m256i mask, int value) {
+  return _mm256_and_si256(mask, splat8(value));
+}
+
+ZOO_AVX2 static inline __m256i clamp8(__m256i value) {
+  return _mm256_min_epi32(_mm256_max_epi32(value, _mm256_setzero_si256()),
+                          _mm256_set1_epi32(KERNEL_MAX_STAT));
+}
+
+// clamp(value - penalty) in the lanes where applies is set, untouched elsewhere
+ZOO_AVX2 static inline __m256i penalize8(__m256i value, __m256i penalty, __m256i applies) {
+  return _mm256_blendv_epi8(value, clamp8(_mm256_sub_epi32(value, penalty)), applies);
+}
+
+ZOO_AVX2 static inline __m256i loadBytes8(const void* bytes) {
+  return _mm256_cvtepu8_epi32(_mm_loadl_epi64(static_cast<const __m128i*>(bytes)));
+}
+
+ZOO_AVX2 static size_t nightlyAvx2(const NightlyLanes& lanes) {
+  const __m256i hunger_decay = _mm256_load_si256(reinterpret_cast<const __m256i*>(&HUNGER_DECAY32));
+  const __m256i happiness_decay =
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(&HAPPINESS_DECAY32));
+  const __m256i energy_decay = _mm256_load_si256(reinterpret_cast<const __m256i*>(&ENERGY_DECAY32));
+
+  size_t i = 0;
+  for (; i + 8 <= lanes.count; i += 8) {
+    auto* health_ptr = reinterpret_cast<__m256i*>(lanes.health + i);
+    auto* hunger_ptr = reinterpret_cast<__m256i*>(lanes.hunger + i);
+    auto* happiness_ptr = reinterpret_cast<__m256i*>(lanes.happiness + i);
+    auto* energy_ptr = reinterpret_cast<__m256i*>(lanes.energy + i);
+
+    __m256i health = _mm256_loadu_si256(health_ptr);
+    __m256i hunger = _mm256_loadu_si256(hunger_ptr);
+    __m256i happiness = _mm256_loadu_si256(happiness_ptr);
+    __m256i energy = _mm256_loadu_si256(energy_ptr);
+    __m256i species = loadBytes8(lanes.species + i);
+    __m256i placement = loadBytes8(lanes.placement + i);
+
+    // daily decay
+    hunger = clamp8(_mm256_add_epi32(hunger, _mm256_permutevar8x32_epi32(hunger_decay, species)));
+    happiness = clamp8(
+        _mm256_add_epi32(happiness, _mm256_permutevar8x32_epi32(happiness_decay, species)));
+    energy = clamp8(_mm256_add_epi32(energy, _mm256_permutevar8x32_epi32(energy_decay, species)));
+
+    // starvation: 5, 15, 20, 30 from hunger 45, 60, 75, 90
+    __m256i ge45 = _mm256_cmpgt_epi32(hunger, splat8(44));
+    __m256i ge60 = _mm256_cmpgt_epi32(hunger, splat8(59));
+    __m256i ge75 = _mm256_cmpgt_epi32(hunger, splat8(74));
+    __m256i ge90 = _mm256_cmpgt_epi32(hunger, splat8(89));
+    __m256i starvation = _mm256_add_epi32(select8(ge45, 5), select8(ge60, 10));
+    starvation = _mm256_add_epi32(starvation, select8(ge75, 5));
+    starvation = _mm256_add_epi32(starvation, select8(ge90, 10));
+    health = penalize8(health, starvation, ge45);
+
+    // unhappiness: 2, 5, 15 below happiness 60, 40, 20
+    __m256i sad60 = _mm256_cmpgt_epi32(splat8(60), happiness);
+    __m256i sad40 = _mm256_cmpgt_epi32(splat8(40), happiness);
+    __m256i sad20 = _mm256_cmpgt_epi32(splat8(20), happiness);
+    __m256i unhappiness = _mm256_add_epi32(select8(sad60, 2), select8(sad40, 3));
+    unhappiness = _mm256_add_epi32(unhappiness, select8(sad20, 10));
+    health = penalize8(health, unhappiness, sad60);
+
+    // exhaustion: 5, 10 below energy 40, 20
+    __m256i tired40 = _mm256_cmpgt_epi32(splat8(40), energy);
+    __m256i tired20 = _mm256_cmpgt_epi32(splat8(20), energy);
+    health = penalize8(health, _mm256_add_epi32(select8(tired40, 5), select8(tired20, 5)), tired40);
+
+    // habitat
+    __m256i homeless = _mm256_cmpeq_epi32(placement, splat8(HOMELESS_LANE));
+    __m256i preferred = _mm256_cmpeq_epi32(placement, splat8(PREFERRED_LANE));
+    __m256i other = _mm256_cmpeq_epi32(placement, splat8(OTHER_LANE));
+    __m256i habitat_delta = _mm256_or_si256(select8(homeless, -15), select8(preferred, 3));
+    habitat_delta = _mm256_or_si256(habitat_delta, select8(other, -2));
+    happiness = clamp8(_mm256_add_epi32(happiness, habitat_delta));
+    health = penalize8(health, splat8(5), homeless);
+
+    // nightly recovery
+    energy = clamp8(_mm256_add_epi32(energy, splat8(8)));
+    health = clamp8(_mm256_add_epi32(health, splat8(1)));
+    hunger = clamp8(_mm256_add_epi32(hunger, splat8(8)));
+
+    _mm256_storeu_si256(health_ptr, health);
+    _mm256_storeu_si256(hunger_ptr, hunger);
+    _mm256_storeu_si256(happiness_ptr, happiness);
+    _mm256_storeu_si256(energy_ptr, energy);
+  }
+  return i;
+}
+
+// SSE4.1, 4 lanes per step
+
+#define ZOO_SSE41 __attribute__((target("sse4.1")))
+
+ZOO_SSE41 static inline __m128i splat4(int value) {
+  return _mm_set1_epi32(value);
+}
+
+ZOO_SSE41 static inline __m128i select4(__m128i mask, int value) {
+  return _mm_and_si128(mask, splat4(value));
+}
+
+ZOO_SSE41 static inline __m128i clamp4(__m128i value) {
+  return _mm_min_epi32(_mm_max_epi32(value, _mm_setzero_si128()), _mm_set1_epi32(KERNEL_MAX_STAT));
+}
+
+ZOO_SSE41 static inline __m128i penalize4(__m128i value, __m128i penalty, __m128i applies) {
+  return _mm_blendv_epi8(value, clamp4(_mm_sub_epi32(value, penalty)), applies);
+}
+
+ZOO_SSE41 static inline __m128i loadBytes4(const void* bytes) {
+  int32_t packed;
+  std::memcpy(&packed, bytes, sizeof(packed));
+  return _mm_cvtsi32_si128(packed);
+}
+
+// looks up 4 species bytes in a 16-entry int8 table and widens the result
+ZOO_SSE41 static inline __m128i lookup4(__m128i table, __m128i species_bytes) {
+  return _mm_cvtepi8_epi32(_mm_shuffle_epi8(table, species_bytes));
+}
+
+ZOO_SSE41 static size_t nightlySse41(const NightlyLanes& lanes) {
+  const __m128i hunger_decay = _mm_load_si128(reinterpret_cast<const __m128i*>(&HUNGER_DECAY8));
+  const __m128i happiness_decay =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(&HAPPINESS_DECAY8));
+  const __m128i energy_decay = _mm_load_si128(reinterpret_cast<const __m128i*>(&ENERGY_DECAY8));
+
+  size_t i = 0;
+  for (; i + 4 <= lanes.count; i += 4) {
+    auto* health_ptr = reinterpret_cast<__m128i*>(lanes.health + i);
+    auto* hunger_ptr = reinterpret_cast<__m128i*>(lanes.hunger + i);
+    auto* happiness_ptr = reinterpret_cast<__m128i*>(lanes.happiness + i);
+    auto* energy_ptr = reinterpret_cast<__m128i*>(lanes.energy + i);
+
+    __m128i health = _mm_loadu_si128(health_ptr);
+    __m128i hunger = _mm_loadu_si128(hunger_ptr);
+    __m128i happiness = _mm_loadu_si128(happiness_ptr);
+    __m128i energy = _mm_loadu_si128(energy_ptr);
+    __m128i species = loadBytes4(lanes.species + i);
+    __m128i placement = _mm_cvtepu8_epi32(loadBytes4(lanes.placement + i));
+
+    // daily decay
+    hunger = clamp4(_mm_add_epi32(hunger, lookup4(hunger_decay, species)));
+    happiness = clamp4(_mm_add_epi32(happiness, lookup4(happiness_decay, species)));
+    energy = clamp4(_mm_add_epi32(energy, lookup4(energy_decay, species)));
+
+    // starvation: 5, 15, 20, 30 from hunger 45, 60, 75, 90
+    __m128i ge45 = _mm_cmpgt_epi32(hunger, splat4(44));
+    __m128i ge60 = _mm_cmpgt_epi32(hunger, splat4(59));
+    __m128i ge75 = _mm_cmpgt_epi32(hunger, splat4(74));
+    __m128i ge90 = _mm_cmpgt_epi32(hunger, splat4(89));
+    __m128i starvation = _mm_add_epi32(select4(ge45, 5), select4(ge60, 10));
+    starvation = _mm_add_epi32(starvation, select4(ge75, 5));
+    starvation = _mm_add_epi32(starvation, select4(ge90, 10));
+    health = penalize4(health, starvation, ge45);
+
+    // unhappiness: 2, 5, 15 below happiness 60, 40, 20
+    __m128i sad60 = _mm_cmpgt_epi32(splat4(60), happiness);
+    __m128i sad40 = _mm_cmpgt_epi32(splat4(40), happiness);
+    __m128i sad20 = _mm_cmpgt_epi32(splat4(20), happiness);
+    __m128i unhappiness = _mm_add_epi32(select4(sad60, 2), select4(sad40, 3));
+    unhappiness = _mm_add_epi32(unhappiness, select4(sad20, 10));
+    health = penalize4(health, unhappiness, sad60);
+
+    // exhaustion: 5, 10 below energy 40, 20
+    __m128i tired40 = _mm_cmpgt_epi32(splat4(40), energy);
+    __m128i tired20 = _mm_cmpgt_epi32(splat4(20), energy);
+    health = penalize4(health, _mm_add_epi32(select4(tired40, 5), select4(tired20, 5)), tired40);
+
+    // habitat
+    __m128i homeless = _mm_cmpeq_epi32(placement, splat4(HOMELESS_LANE));
+    __m128i preferred = _mm_cmpeq_epi32(placement, splat4(PREFERRED_LANE));
+    __m128i other = _mm_cmpeq_epi32(placement, splat4(OTHER_LANE));
+    __m128i habitat_delta = _mm_or_si128(select4(homeless, -15), select4(preferred, 3));
+    habitat_delta = _mm_or_si128(habitat_delta, select4(other, -2));
+    happiness = clamp4(_mm_add_epi32(happiness, habitat_delta));
+    health = penalize4(health, splat4(5), homeless);
+
+    // nightly recovery
+    energy = clamp4(_mm_add_epi32(energy, splat4(8)));
+    health = clamp4(_mm_add_epi32(health, splat4(1)));
+    hunger = clamp4(_mm_add_epi32(hunger, splat4(8)));
+
+    _mm_storeu_si128(health_ptr, health);
+    _mm_storeu_si128(hunger_ptr, hunger);
+    _mm_storeu_si128(happiness_ptr, happiness);
+    _mm_storeu_si128(energy_ptr, energy);
+  }
+  return i;
+}
+
+#endif  // ZOO_X86_KERNELS
+
+bool kernelIsaSupported(KernelIsa isa) {
+  switch (isa) {
+    case KernelIsa::SCALAR:
+      return true;
+#if ZOO_X86_KERNELS
+    case KernelIsa::SSE41:
+      return __builtin_cpu_supports("sse4.1");
+    case KernelIsa::AVX2:
+      return __builtin_cpu_supports("avx2");
+#else
+    default:
+      return false;
+#endif
+  }
+  return false;
+}
+
+KernelIsa detectKernelIsa() {
+  static const KernelIsa isa = [] {
+    if (kernelIsaSupported(KernelIsa::AVX2)) {
+      return KernelIsa::AVX2;
+    }
+    if (kernelIsaSupported(KernelIsa::SSE41)) {
+      return KernelIsa::SSE41;
+    }
+    return KernelIsa::SCALAR;
+  }();
+  return isa;
+}
+
+const char* kernelIsaName(KernelIsa isa) {
+  switch (isa) {
+    case KernelIsa::SCALAR:
+      return "scalar";
+    case KernelIsa::SSE41:
+      return "sse4.1";
+    case KernelIsa::AVX2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+void runNightlyKernel(const NightlyLanes& lanes) {
+  runNightlyKernel(lanes, detectKernelIsa());
+}
+
+void runNightlyKernel(const NightlyLanes& lanes, KernelIsa isa) {
+  size_t done = 0;
+#if ZOO_X86_KERNELS
+  if (isa == KernelIsa::AVX2) {
+    done = nightlyAvx2(lanes);
+  } else if (isa == KernelIsa::SSE41) {
+    done = nightlySse41(lanes);
+  }
+#else
+  (void)isa;
+#endif
+  nightlyScalar(lanes, done);
+}
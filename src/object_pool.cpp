@@ -0,0 +1,85 @@
+#include "object_pool.h"
+
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
+static constexpr size_t CLASS_GRANULARITY = 32;
+static constexpr size_t CLASS_COUNT = 16;  // objects up to 512 bytes are pooled
+static constexpr size_t CHUNK_OBJECTS = 64;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct ThreadFreeLists {
+  std::array<FreeBlock*, CLASS_COUNT> free_lists{};
+  PoolStats stats;
+};
+
+static thread_local ThreadFreeLists thread_free_lists;
+
+// blocks can be freed on a different thread than the one that carved them, so chunks outlive
+// their thread and stay reachable from here
+static std::mutex chunks_mutex;
+static std::vector<void*> chunks;
+
+static size_t sizeClass(size_t size) {
+  return (size + CLASS_GRANULARITY - 1) / CLASS_GRANULARITY - 1;
+}
+
+static FreeBlock* allocateChunk(size_t size_class) {
+  size_t block_size = (size_class + 1) * CLASS_GRANULARITY;
+  auto* chunk = static_cast<std::byte*>(::operator new(block_size * CHUNK_OBJECTS));
+  {
+    std::lock_guard<std::mutex> lock(chunks_mutex);
+    chunks.push_back(chunk);
+  }
+  thread_free_lists.stats.chunk_allocations++;
+
+  // thread the chunk's blocks into a free list
+  FreeBlock* head = nullptr;
+  for (size_t i = CHUNK_OBJECTS; i-- > 0;) {
+    auto* block = reinterpret_cast<FreeBlock*>(chunk + i * block_size);
+    block->next = head;
+    head = block;
+  }
+  return head;
+}
+
+void* poolAllocate(size_t size) {
+  thread_free_lists.stats.allocations++;
+  if (size == 0 || sizeClass(size) >= CLASS_COUNT) {
+    thread_free_lists.stats.chunk_allocations++;
+    return ::operator new(size);
+  }
+
+  FreeBlock*& free_list = thread_free_lists.free_lists[sizeClass(size)];
+  if (!free_list) {
+    free_list = allocateChunk(sizeClass(size));
+  }
+  FreeBlock* block = free_list;
+  free_list = block->next;
+  return block;
+}
+
+void poolDeallocate(void* ptr, size_t size) noexcept {
+  if (!ptr) {
+    return;
+  }
+  thread_free_lists.stats.deallocations++;
+  if (size == 0 || sizeClass(size) >= CLASS_COUNT) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  auto* block = static_cast<FreeBlock*>(ptr);
+  FreeBlock*& free_list = thread_free_lists.free_lists[sizeClass(size)];
+  block->next = free_list;
+  free_list = block;
+}
+
+PoolStats poolStats() {
+  return thread_free_lists.stats;
+}
@@ -1,21 +1,27 @@
 #include "player.h"
 
-#include <iostream>
-
 Player::Player(std::string name) : name_(std::move(name)) {}
 
 const std::string& Player::getName() const {
   return name_;
 }
 
+EventSink& Player::getEventSink() const {
+  return *sink_;
+}
+
+void Player::setEventSink(EventSink& sink) {
+  sink_ = &sink;
+}
+
 bool Player::validateAnimal(Animal* animal) {
   if (!animal) {
-    std::cout << "Animal does not exist!\n";
+    sink_->emit({.type = EventType::ANIMAL_MISSING});
     return false;
   }
 
   if (!animal->isAlive()) {
-    std::cout << "Animal is not alive.\n";
+    sink_->emit({.type = EventType::ANIMAL_NOT_ALIVE});
     return false;
   }
   return true;
@@ -27,13 +33,17 @@ bool Player::feedAnimal(Zoo& zoo, Animal* animal) {
   }
 
   if (zoo.getBalance() < animal->getFeedingCost()) {
-    std::cout << "Not enough money to feed " << animal->getName() << " the " << animal->getSpecies()
-              << ".\n";
+    sink_->emit({.type = EventType::FEEDING_UNAFFORDABLE,
+                 .subject = animal->getName(),
+                 .species = animal->getSpecies()});
     return false;
   }
 
-  std::cout << name_ << " fed " << animal->getName() << " the " << animal->getSpecies() << " for $"
-            << animal->getFeedingCost() << ".\n";
+  sink_->emit({.type = EventType::ANIMAL_FED,
+               .actor = name_,
+               .subject = animal->getName(),
+               .species = animal->getSpecies(),
+               .amount = animal->getFeedingCost()});
   zoo.spendMoney(animal->getFeedingCost());
   animal->eat(20);
   return true;
@@ -45,12 +55,16 @@ bool Player::playWithAnimal(Animal* animal) {
   }
 
   if (animal->getEnergyLevel() < 20) {
-    std::cout << animal->getName() << " the " << animal->getSpecies() << " is too tired to play.\n";
+    sink_->emit({.type = EventType::TOO_TIRED_TO_PLAY,
+                 .subject = animal->getName(),
+                 .species = animal->getSpecies()});
     return false;
   }
 
-  std::cout << name_ << " played with " << animal->getName() << " the " << animal->getSpecies()
-            << ".\n";
+  sink_->emit({.type = EventType::ANIMAL_PLAYED,
+               .actor = name_,
+               .subject = animal->getName(),
+               .species = animal->getSpecies()});
   animal->receivePlay();
   return true;
 }
@@ -62,13 +76,16 @@ bool Player::exerciseAnimal(Animal* animal) {
 
   // check if animal has enough energy
   if (animal->getEnergyLevel() < 30) {
-    std::cout << animal->getName() << " the " << animal->getSpecies()
-              << " is too tired to exercise.\n";
+    sink_->emit({.type = EventType::TOO_TIRED_TO_EXERCISE,
+                 .subject = animal->getName(),
+                 .species = animal->getSpecies()});
     return false;
   }
 
-  std::cout << name_ << " exercised " << animal->getName() << " the " << animal->getSpecies()
-            << ".\n";
+  sink_->emit({.type = EventType::ANIMAL_EXERCISED,
+               .actor = name_,
+               .subject = animal->getName(),
+               .species = animal->getSpecies()});
   animal->receiveExercise();
   return true;
 }
@@ -79,25 +96,30 @@ bool Player::treatAnimal(Zoo& zoo, Animal* animal) {
   }
 
   if (zoo.getBalance() < 50.0) {
-    std::cout << "Not enough money to treat " << animal->getName() << " the "
-              << animal->getSpecies() << "!\n";
+    sink_->emit({.type = EventType::TREATMENT_UNAFFORDABLE,
+                 .subject = animal->getName(),
+                 .species = animal->getSpecies()});
     return false;
   }
 
   zoo.spendMoney(50.0);
-  std::cout << name_ << " gave medical care to " << animal->getName() << " the "
-            << animal->getSpecies() << " for $50.\n";
+  sink_->emit({.type = EventType::ANIMAL_TREATED,
+               .actor = name_,
+               .subject = animal->getName(),
+               .species = animal->getSpecies(),
+               .amount = 50.0});
   animal->receiveTreatment();
   return true;
 }
 
 bool Player::cleanExhibit(Exhibit* exhibit) {
   if (!exhibit) {
-    std::cout << "Exhibit does not exist.\n";
+    sink_->emit({.type = EventType::EXHIBIT_MISSING});
     return false;
   }
 
-  std::cout << name_ << " cleaned " << exhibit->getName() << ".\n";
+  sink_->emit(
+      {.type = EventType::PLAYER_CLEANED_EXHIBIT, .actor = name_, .place = exhibit->getName()});
   exhibit->clean();
   return true;
 }
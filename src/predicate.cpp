@@ -0,0 +1,296 @@
+#include "predicate.h"
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <optional>
+
+#include "command_script.h"
+
+// indexed by MissionVar
+static constexpr std::array<std::string_view, MISSION_VAR_COUNT> VAR_NAMES = {
+    "animals", "exhibits", "species", "homeless", "misplaced", "sick",
+    "needy", "min_cleanliness", "dirty", "balance", "fed", "cleaned",
+    "played", "exercised", "species_mask", "projected_balance", "rating", "visitors",
+};
+
+struct ComparisonSpec {
+  std::string_view symbol;
+  PredicateOp op;
+};
+
+static constexpr std::array<ComparisonSpec, 6> COMPARISONS = {{
+    {"<", PredicateOp::LT},
+    {"<=", PredicateOp::LE},
+    {">", PredicateOp::GT},
+    {">=", PredicateOp::GE},
+    {"==", PredicateOp::EQ},
+    {"!=", PredicateOp::NE},
+}};
+
+// what each mission type is checked by, indexed by MissionType
+static constexpr std::array<std::string_view, MISSION_TYPE_COUNT> DEFAULT_PREDICATES = {
+    "homeless < animals",                         // ADD_ANIMAL_TO_EXHIBIT
+    "animals >= param",                           // OWN_X_ANIMALS
+    "species >= param",                           // OWN_X_SPECIES
+    "exhibits >= param",                          // OWN_X_EXHIBITS
+    "fed == param",                               // FEED_X_ANIMALS
+    "played",                                     // PLAY_WITH_ANIMAL
+    "exercised",                                  // EXERCISE_ANIMAL
+    "needy == 0",                                 // NO_ANIMALS_NEED_ATTENTION
+    "sick == 0",                                  // NO_SICK_ANIMALS
+    "homeless == 0",                              // NO_HOMELESS_ANIMALS
+    "homeless == 0 and misplaced == 0",           // PREFERRED_HABITATS
+    "cleaned >= param",                           // CLEAN_X_EXHIBITS
+    "exhibits == 0 or min_cleanliness >= param",  // EXHIBITS_CLEANLINESS_AT_LEAST_X
+    "projected_balance >= amount",                // BALANCE_AT_LEAST
+    "rating >= amount",                           // ZOO_RATING_ABOVE
+    "visitors >= param",                          // ATTRACT_X_VISITORS
+    "owns elephant",                              // OWN_ELEPHANT
+    "owns penguin or owns monkey",                // OWN_MEDIUM_ANIMAL
+    "owns bear or owns lion",                     // OWN_SPECIAL_ANIMAL
+};
+
+// recursive descent over the tokens, emitting postfix code and tracking the stack depth
+class PredicateCompiler {
+ public:
+  PredicateCompiler(std::span<const std::string_view> tokens, PredicateProgram& program,
+                    std::string& error)
+      : tokens_(tokens), program_(program), error_(error) {}
+
+  bool compile() {
+    program_ = {};
+    if (!orExpression()) {
+      return false;
+    }
+    if (pos_ < tokens_.size()) {
+      return fail("unexpected \"" + std::string(tokens_[pos_]) + "\"");
+    }
+    if (max_depth_ > static_cast<int>(PREDICATE_MAX_STACK)) {
+      return fail("condition is too deeply nested");
+    }
+    return true;
+  }
+
+ private:
+  bool orExpression() {
+    if (!andExpression()) {
+      return false;
+    }
+    while (accept("or")) {
+      if (!andExpression()) {
+        return false;
+      }
+      emit({PredicateOp::OR}, -1);
+    }
+    return true;
+  }
+
+  bool andExpression() {
+    if (!unary()) {
+      return false;
+    }
+    while (accept("and")) {
+      if (!unary()) {
+        return false;
+      }
+      emit({PredicateOp::AND}, -1);
+    }
+    return true;
+  }
+
+  bool unary() {
+    if (accept("not")) {
+      if (!unary()) {
+        return false;
+      }
+      emit({PredicateOp::NOT}, 0);
+      return true;
+    }
+    if (accept("owns")) {
+      if (pos_ == tokens_.size()) {
+        return fail("\"owns\" needs a species");
+      }
+      std::optional<Species> species = speciesFromScript(tokens_[pos_]);
+      if (!species) {
+        return fail("unknown species \"" + std::string(tokens_[pos_]) + "\"");
+      }
+      ++pos_;
+      double mask = speciesBit(*species);
+      emit({PredicateOp::OWNS, MissionVar::SPECIES_MASK, mask}, 1);
+      return true;
+    }
+    return comparison();
+  }
+
+  bool comparison() {
+    if (!operand()) {
+      return false;
+    }
+    if (pos_ == tokens_.size()) {
+      return true;
+    }
+    for (const ComparisonSpec& spec : COMPARISONS) {
+      if (tokens_[pos_] == spec.symbol) {
+        ++pos_;
+        if (!operand()) {
+          return false;
+        }
+        emit({spec.op}, -1);
+        return true;
+      }
+    }
+    return true;
+  }
+
+  bool operand() {
+    if (pos_ == tokens_.size()) {
+      return fail("condition ends early");
+    }
+    std::string_view word = tokens_[pos_++];
+    if (scriptWordEquals(word, "param")) {
+      emit({PredicateOp::INT_PARAM}, 1);
+      return true;
+    }
+    if (scriptWordEquals(word, "amount")) {
+      emit({PredicateOp::FLOAT_PARAM}, 1);
+      return true;
+    }
+    for (size_t var = 0; var < MISSION_VAR_COUNT; ++var) {
+      if (static_cast<MissionVar>(var) != MissionVar::SPECIES_MASK &&
+          scriptWordEquals(word, VAR_NAMES[var])) {
+        emit({PredicateOp::LOAD, static_cast<MissionVar>(var)}, 1);
+        program_.reads_metrics |= static_cast<MissionVar>(var) >= MissionVar::PROJECTED_BALANCE;
+        return true;
+      }
+    }
+    double value = 0.0;
+    auto result = std::from_chars(word.data(), word.data() + word.size(), value);
+    if (result.ec != std::errc() || result.ptr != word.data() + word.size()) {
+      return fail("unknown value \"" + std::string(word) + "\"");
+    }
+    emit({PredicateOp::CONST, MissionVar::ANIMALS, value}, 1);
+    return true;
+  }
+
+  bool accept(std::string_view word) {
+    if (pos_ < tokens_.size() && scriptWordEquals(tokens_[pos_], word)) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  void emit(PredicateInstr instr, int depth_change) {
+    program_.code.push_back(instr);
+    depth_ += depth_change;
+    max_depth_ = std::max(max_depth_, depth_);
+  }
+
+  bool fail(std::string message) {
+    error_ = std::move(message);
+    return false;
+  }
+
+  std::span<const std::string_view> tokens_;
+  size_t pos_ = 0;
+  PredicateProgram& program_;
+  std::string& error_;
+  int depth_ = 0;
+  int max_depth_ = 0;
+};
+
+bool PredicateProgram::evaluate(const MissionVars& vars, const Mission& mission) const {
+  std::array<double, PREDICATE_MAX_STACK> stack;
+  size_t top = 0;
+  for (const PredicateInstr& instr : code) {
+    switch (instr.op) {
+      case PredicateOp::LOAD:
+        stack[top++] = vars[static_cast<size_t>(instr.var)];
+        break;
+      case PredicateOp::CONST:
+        stack[top++] = instr.value;
+        break;
+      case PredicateOp::INT_PARAM:
+        stack[top++] = mission.int_param;
+        break;
+      case PredicateOp::FLOAT_PARAM:
+        stack[top++] = mission.float_param;
+        break;
+      case PredicateOp::OWNS: {
+        double owned = vars[static_cast<size_t>(MissionVar::SPECIES_MASK)];
+        stack[top++] =
+            (static_cast<SpeciesMask>(owned) & static_cast<SpeciesMask>(instr.value)) != 0;
+        break;
+      }
+      case PredicateOp::LT:
+        --top;
+        stack[top - 1] = stack[top - 1] < stack[top];
+        break;
+      case PredicateOp::LE:
+        --top;
+        stack[top - 1] = stack[top - 1] <= stack[top];
+        break;
+      case PredicateOp::GT:
+        --top;
+        stack[top - 1] = stack[top - 1] > stack[top];
+        break;
+      case PredicateOp::GE:
+        --top;
+        stack[top - 1] = stack[top - 1] >= stack[top];
+        break;
+      case PredicateOp::EQ:
+        --top;
+        stack[top - 1] = stack[top - 1] == stack[top];
+        break;
+      case PredicateOp::NE:
+        --top;
+        stack[top - 1] = stack[top - 1] != stack[top];
+        break;
+      case PredicateOp::AND:
+        --top;
+        stack[top - 1] = stack[top - 1] != 0.0 && stack[top] != 0.0;
+        break;
+      case PredicateOp::OR:
+        --top;
+        stack[top - 1] = stack[top - 1] != 0.0 || stack[top] != 0.0;
+        break;
+      case PredicateOp::NOT:
+        stack[top - 1] = stack[top - 1] == 0.0;
+        break;
+    }
+  }
+  return top > 0 && stack[top - 1] != 0.0;
+}
+
+bool compilePredicate(std::span<const std::string_view> tokens, PredicateProgram& program,
+                      std::string& error) {
+  return PredicateCompiler(tokens, program, error).compile();
+}
+
+bool compilePredicate(std::string_view expression, PredicateProgram& program, std::string& error) {
+  std::vector<std::string_view> tokens;
+  ScriptTokenizer tokenizer(expression);
+  std::string_view token;
+  while (tokenizer.next(token)) {
+    tokens.push_back(token);
+  }
+  return compilePredicate(tokens, program, error);
+}
+
+std::string_view missionVarName(MissionVar var) {
+  return VAR_NAMES[static_cast<size_t>(var)];
+}
+
+const PredicateProgram& defaultPredicate(MissionType type) {
+  static const std::array<PredicateProgram, MISSION_TYPE_COUNT> programs = [] {
+    std::array<PredicateProgram, MISSION_TYPE_COUNT> compiled;
+    std::string error;
+    for (size_t type = 0; type < MISSION_TYPE_COUNT; ++type) {
+      [[maybe_unused]] bool ok = compilePredicate(DEFAULT_PREDICATES[type], compiled[type], error);
+      assert(ok);
+    }
+    return compiled;
+  }();
+  return programs[static_cast<size_t>(type)];
+}
@@ -0,0 +1,45 @@
+#include "rng.h"
+
+#include <random>
+
+// splitmix64, spreads any seed (even 0) over the whole xoshiro state
+static uint64_t splitMix(uint64_t& x) {
+  uint64_t z = (x += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+Rng::Rng(uint64_t seed) {
+  reseed(seed);
+}
+
+uint64_t Rng::getSeed() const {
+  return seed_;
+}
+
+void Rng::reseed(uint64_t seed) {
+  seed_ = seed;
+  for (uint64_t& word : state_) {
+    word = splitMix(seed);
+  }
+}
+
+int Rng::rollBetween(int min, int max) {
+  // Lemire's multiply-shift on the high 32 bits of a draw, any int range fits in 2^32, so the
+  // product fits in 64 bits. Rejecting the few low products below the threshold removes bias.
+  const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+  uint64_t product = ((*this)() >> 32) * range;
+  if (static_cast<uint32_t>(product) < range) {
+    const uint64_t threshold = (uint64_t{1} << 32) % range;
+    while (static_cast<uint32_t>(product) < threshold) {
+      product = ((*this)() >> 32) * range;
+    }
+  }
+  return static_cast<int>(static_cast<int64_t>(min) + static_cast<int64_t>(product >> 32));
+}
+
+uint64_t randomSeed() {
+  std::random_device device;
+  return (static_cast<uint64_t>(device()) << 32) | device();
+}
@@ -0,0 +1,35 @@
+#include "screen_buffer.h"
+
+#include <cfloat>
+#include <ostream>
+
+ScreenBuffer::ScreenBuffer(std::ostream& out) : out_(out) {}
+
+ScreenBuffer& ScreenBuffer::operator<<(std::string_view text) {
+  buffer_.append(text);
+  return *this;
+}
+
+ScreenBuffer& ScreenBuffer::operator<<(char c) {
+  buffer_.push_back(c);
+  return *this;
+}
+
+ScreenBuffer& ScreenBuffer::operator<<(Fixed number) {
+  // room for the integer digits of any finite double plus the decimals this game prints
+  char digits[DBL_MAX_10_EXP + 64];
+  auto result = std::to_chars(digits, digits + sizeof(digits), number.value,
+                              std::chars_format::fixed, number.precision);
+  buffer_.append(digits, result.ptr);
+  return *this;
+}
+
+void ScreenBuffer::flush() {
+  out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  out_.flush();
+  buffer_.clear();
+}
+
+std::string_view ScreenBuffer::view() const {
+  return buffer_;
+}
@@ -0,0 +1,110 @@
+// Plays many silent games with a scripted strategy and reports how they went.
+//
+// usage: zooperator_sim [--games n] [--seed n] [--threads n] [--strategy mission|random]
+//                       [--campaign file]
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "simulation.h"
+#include "thread_pool.h"
+
+static void printUsage(const char* program) {
+  std::cerr << "usage: " << program
+            << " [--games n] [--seed n] [--threads n] [--strategy mission|random]"
+            << " [--campaign file]\n";
+}
+
+static double percent(uint64_t part, uint64_t whole) {
+  return whole ? 100.0 * static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+}
+
+int main(int argc, char* argv[]) {
+  size_t games = 10000;
+  uint64_t seed = 1;
+  size_t threads = ThreadPool::shared().workerCount() + 1;
+  std::string strategy_name = "mission";
+  const char* campaign_path = nullptr;
+
+  for (int arg = 1; arg < argc; ++arg) {
+    std::string_view option = argv[arg];
+    if (arg + 1 >= argc) {
+      printUsage(argv[0]);
+      return 2;
+    }
+    try {
+      if (option == "--games") {
+        games = std::stoull(argv[++arg]);
+      } else if (option == "--seed") {
+        seed = std::stoull(argv[++arg]);
+      } else if (option == "--threads") {
+        threads = std::max<size_t>(std::stoull(argv[++arg]), 1);
+      } else if (option == "--strategy") {
+        strategy_name = argv[++arg];
+      } else if (option == "--campaign") {
+        campaign_path = argv[++arg];
+      } else {
+        printUsage(argv[0]);
+        return 2;
+      }
+    } catch (const std::exception&) {
+      std::cerr << "bad value for " << option << "\n";
+      return 2;
+    }
+  }
+
+  std::unique_ptr<Strategy> strategy = makeStrategy(strategy_name);
+  if (!strategy) {
+    std::cerr << "unknown strategy " << strategy_name << "\n";
+    return 2;
+  }
+
+  Campaign campaign;
+  if (campaign_path) {
+    std::string error;
+    if (!campaign.loadFile(campaign_path, error)) {
+      std::cerr << error << "\n";
+      return 2;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  SimulationReport report = simulateGames(*strategy, games, seed, threads,
+                                          campaign_path ? campaign : standardCampaign());
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << report.games << " games, strategy " << strategy->getName() << ", seeds " << seed
+            << ".." << (seed + games - (games ? 1 : 0)) << ", " << threads << " threads\n\n";
+
+  std::cout << "Outcomes:\n";
+  for (size_t i = 0; i < report.outcomes.size(); ++i) {
+    if (report.outcomes[i] == 0) {
+      continue;
+    }
+    std::cout << "  " << std::left << std::setw(16) << gameOutcomeName(static_cast<GameOutcome>(i))
+              << std::right << std::setw(10) << report.outcomes[i] << "  "
+              << percent(report.outcomes[i], report.games) << "%\n";
+  }
+
+  size_t completed = report.outcomes[static_cast<size_t>(GameOutcome::COMPLETED)];
+  std::cout << "\nFinal scores (" << completed << " completed games, mean " << std::setprecision(2)
+            << report.meanScore() << std::setprecision(1) << "):\n";
+  for (size_t score = 0; score < report.scores.size(); ++score) {
+    std::cout << "  " << std::setw(2) << score << "/10 " << std::setw(10) << report.scores[score]
+              << "  " << percent(report.scores[score], completed) << "%\n";
+  }
+
+  std::cout << "\nMissions completed: " << report.missions_completed << "/"
+            << report.missions_offered << " ("
+            << percent(report.missions_completed, report.missions_offered) << "%)\n";
+  std::cout << "Days played: " << report.days_played << "\n";
+  std::cout << "Throughput: " << std::setprecision(0)
+            << (elapsed.count() > 0 ? report.games / elapsed.count() : 0.0) << " games/s ("
+            << std::setprecision(3) << elapsed.count() << " s)\n";
+  return 0;
+}
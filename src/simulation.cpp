@@ -0,0 +1,399 @@
+#include "simulation.h"
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include "event_sink.h"
+#include "thread_pool.h"
+
+// games per parallel task, big enough to amortize scheduling, small enough to balance
+static constexpr size_t SIM_CHUNK = 64;
+
+// keeps a strategy's random choices apart from the game's own rolls
+static constexpr uint64_t STRATEGY_SEED_SALT = 0x5851f42d4c957f2d;
+
+// money the mission strategy keeps back for feeding and treatment unless a required mission
+// needs it
+static constexpr double RESERVE = 400.0;
+
+// cheapest first
+static constexpr std::array<Species, SPECIES_COUNT> SPECIES_BY_COST = {
+    Species::RABBIT, Species::TORTOISE, Species::PENGUIN, Species::MONKEY,
+    Species::BEAR,   Species::LION,     Species::ELEPHANT,
+};
+
+static constexpr std::array<Habitat, 5> HABITATS = {
+    Habitat::GRASSLAND, Habitat::FOREST, Habitat::JUNGLE, Habitat::SAVANNA, Habitat::ARCTIC,
+};
+
+static bool nameTaken(const Zoo& zoo, std::string_view name) {
+  for (const Animal* animal : zoo.animalView()) {
+    if (animal->getName() == name) {
+      return true;
+    }
+  }
+  for (const Exhibit* exhibit : zoo.exhibitView()) {
+    if (exhibit->getName() == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// "Rabbit1", "Rabbit2", ... so script lookups by name stay unambiguous
+static std::string freshName(const Zoo& zoo, std::string_view prefix) {
+  for (int n = 1;; ++n) {
+    std::string name = std::string(prefix) + std::to_string(n);
+    if (!nameTaken(zoo, name)) {
+      return name;
+    }
+  }
+}
+
+static Exhibit* exhibitWithSpace(const Zoo& zoo, Habitat habitat) {
+  for (Exhibit* exhibit : zoo.exhibitView()) {
+    if (exhibit->getHabitat() == habitat && exhibit->canAddAnimal()) {
+      return exhibit;
+    }
+  }
+  return nullptr;
+}
+
+static bool buyAnimal(Game& game, Species species) {
+  const Zoo& zoo = game.getZoo();
+  std::string_view species_name = speciesTraits(species).name;
+  size_t before = zoo.getAnimalCount();
+  game.runCommand("buy " + std::string(species_name) + " " + freshName(zoo, species_name));
+  return zoo.getAnimalCount() > before;
+}
+
+static Exhibit* buildExhibit(Game& game, Habitat habitat) {
+  const Zoo& zoo = game.getZoo();
+  std::string_view habitat_name = habitatName(habitat);
+  size_t before = zoo.getExhibitCount();
+  game.runCommand("build " + std::string(habitat_name) + " " + freshName(zoo, habitat_name));
+  return zoo.getExhibitCount() > before ? zoo.exhibitView().back() : nullptr;
+}
+
+static void placeAnimal(Game& game, Animal* animal, Exhibit* exhibit) {
+  game.runCommand("place " + animal->getName() + " " + exhibit->getName());
+}
+
+std::string_view MissionStrategy::getName() const {
+  return "mission";
+}
+
+void MissionStrategy::playDay(Game& game, Rng& /*rng*/) const {
+  const Zoo& zoo = game.getZoo();
+
+  // what today's missions ask the zoo to own, and which care actions they need
+  size_t species_wanted = 0;
+  size_t animals_wanted = 0;
+  size_t exhibits_wanted = 0;
+  SpeciesMask wanted_species = 0;
+  bool required_purchase = false;
+  bool play = false;
+  bool exercise = false;
+  for (const Mission& mission : game.getMissions()) {
+    if (mission.completed) {
+      continue;
+    }
+    size_t count = static_cast<size_t>(std::max(mission.int_param, 0));
+    bool purchase = true;
+    switch (mission.type) {
+      case MissionType::ADD_ANIMAL_TO_EXHIBIT:
+        animals_wanted = std::max<size_t>(animals_wanted, 1);
+        exhibits_wanted = std::max<size_t>(exhibits_wanted, 1);
+        break;
+      case MissionType::OWN_X_ANIMALS:
+        animals_wanted = std::max(animals_wanted, count);
+        break;
+      case MissionType::OWN_X_SPECIES:
+        species_wanted = std::max(species_wanted, count);
+        break;
+      case MissionType::OWN_X_EXHIBITS:
+        exhibits_wanted = std::max(exhibits_wanted, count);
+        break;
+      case MissionType::OWN_MEDIUM_ANIMAL:
+        if (!(zoo.getSpeciesMask() & MEDIUM_SPECIES)) {
+          wanted_species |= speciesBit(Species::PENGUIN);
+        }
+        break;
+      case MissionType::OWN_SPECIAL_ANIMAL:
+        if (!(zoo.getSpeciesMask() & SPECIAL_SPECIES)) {
+          wanted_species |= speciesBit(Species::BEAR);
+        }
+        break;
+      case MissionType::OWN_ELEPHANT:
+        wanted_species |= speciesBit(Species::ELEPHANT);
+        break;
+      case MissionType::PLAY_WITH_ANIMAL:
+        play = true;
+        purchase = false;
+        break;
+      case MissionType::EXERCISE_ANIMAL:
+        exercise = true;
+        purchase = false;
+        break;
+      default:
+        purchase = false;
+        break;
+    }
+    required_purchase |= purchase && mission.required;
+  }
+
+  // required missions may spend the reserve, everything else leaves it alone
+  double reserve = required_purchase ? 0.0 : RESERVE;
+  // room in any exhibit will do until a preferred one is affordable
+  auto housingCost = [&](Species species) {
+    Habitat habitat = speciesHabitat(species);
+    for (const Exhibit* exhibit : zoo.exhibitView()) {
+      if (exhibit->canAddAnimal()) {
+        return 0.0;
+      }
+    }
+    return habitatTraits(habitat).purchase_cost;
+  };
+  auto affordable = [&](Species species) {
+    double cost = speciesTraits(species).purchase_cost + housingCost(species);
+    return zoo.getBalance() - cost >= reserve;
+  };
+
+  for (Species species : SPECIES_BY_COST) {
+    if ((wanted_species & speciesBit(species)) && !(zoo.getSpeciesMask() & speciesBit(species)) &&
+        affordable(species)) {
+      buyAnimal(game, species);
+    }
+  }
+  for (Species species : SPECIES_BY_COST) {
+    if (static_cast<size_t>(speciesMaskCount(zoo.getSpeciesMask())) >= species_wanted) {
+      break;
+    }
+    if (!(zoo.getSpeciesMask() & speciesBit(species)) && affordable(species)) {
+      buyAnimal(game, species);
+    }
+  }
+  while (zoo.getAnimalCount() < animals_wanted && affordable(Species::RABBIT) &&
+         buyAnimal(game, Species::RABBIT)) {
+  }
+
+  // every animal into an exhibit of its preferred habitat, building one if needed
+  for (Animal* animal : zoo.animalView()) {
+    Exhibit* current = zoo.findAnimalLocation(animal);
+    Habitat habitat = animal->getHabitat();
+    if (current && current->getHabitat() == habitat) {
+      continue;
+    }
+    Exhibit* target = exhibitWithSpace(zoo, habitat);
+    if (!target && zoo.getBalance() - habitatTraits(habitat).purchase_cost >= 0.0) {
+      target = buildExhibit(game, habitat);
+    }
+    if (!target && !current) {
+      // any roof beats none
+      for (Habitat other : HABITATS) {
+        if ((target = exhibitWithSpace(zoo, other))) {
+          break;
+        }
+      }
+    }
+    if (target) {
+      placeAnimal(game, animal, target);
+    }
+  }
+  while (zoo.getExhibitCount() < exhibits_wanted &&
+         zoo.getBalance() - habitatTraits(Habitat::GRASSLAND).purchase_cost >= 0.0 &&
+         buildExhibit(game, Habitat::GRASSLAND)) {
+  }
+
+  // action points: mission care first, then cleaning, treatment and feeding
+  std::vector<Animal*> animals(zoo.animalView().begin(), zoo.animalView().end());
+  if (animals.empty()) {
+    return;
+  }
+  auto hasPoints = [&] { return game.isRunning() && game.getActionPoints() > 0; };
+
+  if (play && hasPoints()) {
+    game.runCommand("play " + animals.front()->getName());
+  }
+  if (exercise && hasPoints()) {
+    game.runCommand("exercise " + animals.front()->getName());
+  }
+
+  std::vector<Exhibit*> exhibits(zoo.exhibitView().begin(), zoo.exhibitView().end());
+  std::ranges::sort(exhibits, {}, &Exhibit::getCleanliness);
+  for (Exhibit* exhibit : exhibits) {
+    if (!hasPoints() || exhibit->getCleanliness() > 70) {
+      break;
+    }
+    game.runCommand("clean " + exhibit->getName());
+  }
+
+  std::ranges::sort(animals, {}, &Animal::getHealthLevel);
+  for (Animal* animal : animals) {
+    if (!hasPoints() || !animal->needsAttention() || zoo.getBalance() < RESERVE) {
+      break;
+    }
+    game.runCommand("treat " + animal->getName());
+  }
+
+  std::ranges::sort(animals, std::ranges::greater{}, &Animal::getHungerLevel);
+  for (Animal* animal : animals) {
+    if (!hasPoints()) {
+      break;
+    }
+    game.runCommand("feed " + animal->getName());
+  }
+}
+
+std::string_view RandomStrategy::getName() const {
+  return "random";
+}
+
+void RandomStrategy::playDay(Game& game, Rng& rng) const {
+  const Zoo& zoo = game.getZoo();
+  auto randomAnimal = [&]() -> Animal* {
+    size_t count = zoo.getAnimalCount();
+    return count ? zoo.animalView()[rng.rollBetween(0, static_cast<int>(count) - 1)] : nullptr;
+  };
+  auto randomExhibit = [&]() -> Exhibit* {
+    size_t count = zoo.getExhibitCount();
+    return count ? zoo.exhibitView()[rng.rollBetween(0, static_cast<int>(count) - 1)] : nullptr;
+  };
+
+  int moves = rng.rollBetween(2, 10);
+  for (int move = 0; move < moves && game.isRunning(); ++move) {
+    switch (rng.rollBetween(0, 5)) {
+      case 0:
+        buyAnimal(game, static_cast<Species>(rng.rollBetween(0, SPECIES_COUNT - 1)));
+        break;
+      case 1:
+        buildExhibit(game, HABITATS[rng.rollBetween(0, HABITATS.size() - 1)]);
+        break;
+      case 2: {
+        Animal* animal = randomAnimal();
+        Exhibit* exhibit = randomExhibit();
+        if (animal && exhibit) {
+          placeAnimal(game, animal, exhibit);
+        }
+        break;
+      }
+      case 3:
+        if (Animal* animal = randomAnimal()) {
+          game.runCommand("feed " + animal->getName());
+        }
+        break;
+      case 4:
+        if (Exhibit* exhibit = randomExhibit()) {
+          game.runCommand("clean " + exhibit->getName());
+        }
+        break;
+      case 5:
+        if (Animal* animal = randomAnimal()) {
+          game.runCommand("play " + animal->getName());
+        }
+        break;
+    }
+  }
+}
+
+std::unique_ptr<Strategy> makeStrategy(std::string_view name) {
+  if (name == "mission") {
+    return std::make_unique<MissionStrategy>();
+  }
+  if (name == "random") {
+    return std::make_unique<RandomStrategy>();
+  }
+  return nullptr;
+}
+
+void SimulationReport::add(const SimulationReport& other) {
+  games += other.games;
+  for (size_t i = 0; i < outcomes.size(); ++i) {
+    outcomes[i] += other.outcomes[i];
+  }
+  for (size_t i = 0; i < scores.size(); ++i) {
+    scores[i] += other.scores[i];
+  }
+  missions_offered += other.missions_offered;
+  missions_completed += other.missions_completed;
+  days_played += other.days_played;
+}
+
+double SimulationReport::meanScore() const {
+  size_t completed = 0;
+  uint64_t total = 0;
+  for (size_t score = 0; score < scores.size(); ++score) {
+    completed += scores[score];
+    total += score * scores[score];
+  }
+  return completed ? static_cast<double>(total) / completed : 0.0;
+}
+
+SimulationReport simulateGame(const Strategy& strategy, uint64_t seed, const Campaign& campaign) {
+  std::ostream silent(nullptr);  // no buffer, so every write is dropped
+  NullEventSink sink;
+  Game game(Player("Simulator"), "Simulated Zoo", seed, silent);
+  game.setEventSink(sink);
+  game.setCampaign(campaign);
+  Rng rng(seed ^ STRATEGY_SEED_SALT);
+
+  int stalled_days = 0;
+  while (game.isRunning() && stalled_days < MAX_STALLED_DAYS) {
+    int day = game.getZoo().getDay();
+    strategy.playDay(game, rng);
+    if (game.isRunning()) {
+      game.runCommand("end");
+    }
+    stalled_days = game.getZoo().getDay() == day ? stalled_days + 1 : 0;
+  }
+
+  const GameResult& result = game.getResult();
+  SimulationReport report;
+  report.games = 1;
+  report.outcomes[static_cast<size_t>(result.outcome)] = 1;
+  if (result.outcome == GameOutcome::COMPLETED) {
+    report.scores[std::clamp(result.score, 0, MAX_FINAL_SCORE)] = 1;
+  }
+  report.missions_offered = result.missions_offered;
+  report.missions_completed = result.missions_completed;
+  report.days_played = game.getZoo().getDay() - 1;
+  return report;
+}
+
+SimulationReport simulateGames(const Strategy& strategy, size_t games, uint64_t first_seed,
+                               size_t workers, const Campaign& campaign) {
+  size_t chunks = (games + SIM_CHUNK - 1) / SIM_CHUNK;
+  std::vector<SimulationReport> chunk_reports(chunks);
+  ThreadPool::shared().parallelFor(chunks, workers, [&](size_t chunk) {
+    size_t begin = chunk * SIM_CHUNK;
+    size_t end = std::min(begin + SIM_CHUNK, games);
+    for (size_t i = begin; i < end; ++i) {
+      chunk_reports[chunk].add(simulateGame(strategy, first_seed + i, campaign));
+    }
+  });
+
+  SimulationReport report;
+  for (const SimulationReport& chunk_report : chunk_reports) {
+    report.add(chunk_report);
+  }
+  return report;
+}
+
+std::string_view gameOutcomeName(GameOutcome outcome) {
+  switch (outcome) {
+    case GameOutcome::PLAYING:
+      return "stalled";
+    case GameOutcome::COMPLETED:
+      return "completed";
+    case GameOutcome::MISSION_FAILED:
+      return "mission failed";
+    case GameOutcome::BANKRUPT:
+      return "bankrupt";
+    case GameOutcome::NO_ANIMALS:
+      return "no animals";
+    case GameOutcome::QUIT:
+      return "quit";
+  }
+  return "unknown";
+}
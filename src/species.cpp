@@ -0,0 +1,33 @@
+#include "species.h"
+
+#include <array>
+
+// indexed by Habitat
+static constexpr std::array<std::string_view, 6> HABITAT_NAMES = {
+    "Unknown", "Grassland", "Forest", "Jungle", "Savanna", "Arctic",
+};
+
+// shared by every animal of a species, so animals don't carry their own copy
+const std::string& speciesName(Species species) {
+  static const std::array<std::string, SPECIES_COUNT> names = [] {
+    std::array<std::string, SPECIES_COUNT> names;
+    for (size_t i = 0; i < SPECIES_COUNT; ++i) {
+      names[i] = std::string(SPECIES_TRAITS[i].name);
+    }
+    return names;
+  }();
+  return names[static_cast<size_t>(species)];
+}
+
+std::string_view habitatName(Habitat habitat) {
+  return HABITAT_NAMES[static_cast<size_t>(habitat)];
+}
+
+Habitat habitatFromName(std::string_view name) {
+  for (size_t i = 1; i < HABITAT_NAMES.size(); ++i) {
+    if (HABITAT_NAMES[i] == name) {
+      return static_cast<Habitat>(i);
+    }
+  }
+  return Habitat::UNKNOWN;
+}
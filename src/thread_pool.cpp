@@ -0,0 +1,150 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+// the pool and queue index of the worker running on this thread, if any
+static thread_local const ThreadPool* current_pool = nullptr;
+static thread_local size_t current_queue = 0;
+
+ThreadPool::ThreadPool(size_t workers) {
+  workers = std::max<size_t>(workers, 1);
+  for (size_t i = 0; i < workers; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  for (size_t i = 0; i < workers; ++i) {
+    threads_.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+ThreadPool& ThreadPool::shared() {
+  static ThreadPool pool;
+  return pool;
+}
+
+size_t ThreadPool::defaultWorkerCount() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+size_t ThreadPool::workerCount() const {
+  return threads_.size();
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+  // a worker keeps its own tasks local, other threads spread them round robin
+  size_t index = current_pool == this ? current_queue : next_queue_++ % queues_.size();
+  {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    pending_++;
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+
+  // take the sleep lock so a worker between its check and its wait cannot miss the wakeup
+  { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  wake_.notify_one();
+}
+
+void ThreadPool::parallelFor(size_t count, size_t max_threads,
+                             const std::function<void(size_t)>& body) {
+  size_t threads = std::min({max_threads, count, workerCount() + 1});
+  if (threads <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> finished{0};
+  auto drain = [&] {
+    for (size_t i = next++; i < count; i = next++) {
+      body(i);
+    }
+  };
+
+  size_t helpers = threads - 1;
+  for (size_t i = 0; i < helpers; ++i) {
+    submit([&] {
+      drain();
+      finished++;
+    });
+  }
+  drain();
+
+  // the helpers reference this frame, so wait for every one of them, running queued work
+  // (possibly the helpers themselves) meanwhile
+  while (finished.load() < helpers) {
+    if (!runOneTask()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+bool ThreadPool::runOneTask() {
+  std::function<void()> task;
+  if (current_pool == this) {
+    task = popOwn(current_queue);
+    if (!task) {
+      task = steal(current_queue + 1);
+    }
+  } else {
+    task = steal(0);
+  }
+  if (!task) {
+    return false;
+  }
+  task();
+  return true;
+}
+
+std::function<void()> ThreadPool::popOwn(size_t index) {
+  Queue& queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) {
+    return {};
+  }
+  std::function<void()> task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  pending_--;
+  return task;
+}
+
+std::function<void()> ThreadPool::steal(size_t first) {
+  for (size_t i = 0; i < queues_.size(); ++i) {
+    Queue& queue = *queues_[(first + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      std::function<void()> task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      pending_--;
+      return task;
+    }
+  }
+  return {};
+}
+
+void ThreadPool::workerLoop(size_t index) {
+  current_pool = this;
+  current_queue = index;
+  while (true) {
+    if (runOneTask()) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] { return stopping_ || pending_.load() > 0; });
+    if (stopping_ && pending_.load() == 0) {
+      return;
+    }
+  }
+}
@@ -1,12 +1,22 @@
 #include "zoo.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
-#include <set>
+#include <iterator>
 
-Zoo::Zoo(std::string name, double starting_balance)
-    : name_(std::move(name)), day_(1), balance_(starting_balance) {}
+#include "thread_pool.h"
+
+Zoo::Zoo(std::string name, double starting_balance, uint64_t seed)
+    : name_(std::move(name)),
+      day_(1),
+      balance_(starting_balance),
+      workers_(ThreadPool::shared().workerCount()),
+      rng_(seed) {
+  animals_.setLazyDecay(true);
+}
 
 // getters
 const std::string& Zoo::getName() const {
@@ -21,18 +31,45 @@ double Zoo::getBalance() const {
   return balance_;
 }
 
+EventSink& Zoo::getEventSink() const {
+  return *sink_;
+}
+
+void Zoo::setEventSink(EventSink& sink) {
+  sink_ = &sink;
+  animals_.setEventSink(sink);
+  for (const auto& exhibit : exhibits_) {
+    exhibit->sink_ = &sink;
+  }
+}
+
+size_t Zoo::getWorkerCount() const {
+  return workers_;
+}
+
+void Zoo::setWorkerCount(size_t workers) {
+  workers_ = std::max<size_t>(workers, 1);
+}
+
+Rng& Zoo::getRng() {
+  return rng_;
+}
+
 // animal management
 bool Zoo::purchaseAnimal(std::unique_ptr<Animal> animal) {
   double cost = animal->getPurchaseCost();
   if (balance_ < cost) {
-    std::cout << "Insufficient funds, cannot purchase animal.\n";
+    sink_->emit({.type = EventType::ANIMAL_UNAFFORDABLE});
     return false;
   }
 
-  std::cout << "Purchased " << animal->getName() << " the " << animal->getSpecies() << " for $"
-            << cost << ".\n";
+  sink_->emit({.type = EventType::ANIMAL_PURCHASED,
+               .subject = animal->getName(),
+               .species = animal->getSpecies(),
+               .amount = cost});
   balance_ -= cost;
-  animals_.push_back(std::move(animal));
+  version_++;
+  animals_.insert(std::move(animal));
   return true;
 }
 
@@ -41,11 +78,8 @@ bool Zoo::sellAnimal(Animal* animal) {
     return false;
   }
 
-  auto it =
-      std::find_if(animals_.begin(), animals_.end(),
-                   [animal](const std::unique_ptr<Animal>& ptr) { return ptr.get() == animal; });
-  if (it == animals_.end()) {
-    std::cout << "Animal not found in zoo!\n";
+  if (!animals_.contains(*animal)) {
+    sink_->emit({.type = EventType::SOLD_ANIMAL_NOT_IN_ZOO});
     return false;
   }
 
@@ -55,49 +89,80 @@ bool Zoo::sellAnimal(Animal* animal) {
     exhibit->removeAnimal(animal);
   }
 
-  double sell_price = (*it)->getPurchaseCost() / 2.0;
+  double sell_price = animal->getPurchaseCost() / 2.0;
 
-  std::cout << "Sold " << (*it)->getName() << " the " << (*it)->getSpecies() << " for $"
-            << sell_price << "!\n";
+  sink_->emit({.type = EventType::ANIMAL_SOLD,
+               .subject = animal->getName(),
+               .species = animal->getSpecies(),
+               .amount = sell_price});
   balance_ += sell_price;
+  version_++;
 
-  animals_.erase(it);
+  animals_.remove(animal->getId());
   return true;
 }
 
+Animal* Zoo::findAnimal(AnimalId id) const {
+  return animals_.find(id);
+}
+
 std::vector<Animal*> Zoo::getAllAnimals() {
-  std::vector<Animal*> animals;
-  for (const auto& ptr : animals_) {
-    animals.push_back(ptr.get());
-  }
-  return animals;
+  AnimalView animals = animalView();
+  return {animals.begin(), animals.end()};
 }
 
 std::vector<Animal*> Zoo::getAnimalsNeedingAttention() {
   std::vector<Animal*> animals;
-  for (const auto& ptr : animals_) {
-    if (ptr->needsAttention()) {
-      animals.push_back(ptr.get());
-    }
-  }
+  std::ranges::copy(animalsNeedingAttention(), std::back_inserter(animals));
   return animals;
 }
 
+AnimalView Zoo::animalView() const {
+  return makePointerView(animals_.animals());
+}
+
+AnimalsNeedingAttention Zoo::animalsNeedingAttention() const {
+  return AnimalsNeedingAttention(animalView(), NeedsAttention{});
+}
+
 size_t Zoo::getAnimalCount() const {
   return animals_.size();
 }
 
+size_t Zoo::getSpeciesCount(Species species) const {
+  return animals_.speciesCount(species);
+}
+
+SpeciesMask Zoo::getSpeciesMask() const {
+  return animals_.speciesMask();
+}
+
+size_t Zoo::getPlacementCount(Placement placement) const {
+  return animals_.placementCount(placement);
+}
+
+ThresholdCounts Zoo::getThresholdCounts() const {
+  return animals_.thresholdCounts();
+}
+
 // exhibit management
 bool Zoo::purchaseExhibit(std::unique_ptr<Exhibit> exhibit) {
   double cost = exhibit->getPurchaseCost();
   if (balance_ < cost) {
-    std::cout << "Insufficient funds, cannot purchase exhibit.\n";
+    sink_->emit({.type = EventType::EXHIBIT_UNAFFORDABLE});
     return false;
   }
 
-  std::cout << "Purchased Exhibit " << exhibit->getName() << " for $" << cost << ".\n";
+  sink_->emit({.type = EventType::EXHIBIT_PURCHASED, .place = exhibit->getName(), .amount = cost});
   balance_ -= cost;
-  exhibits_.push_back(std::move(exhibit));
+  version_++;
+  Exhibit* ptr = exhibit.get();
+  ptr->id_ = exhibits_.insert(std::move(exhibit));
+  ptr->totals_ = &exhibit_totals_;
+  ptr->sink_ = sink_;
+  exhibit_totals_.cleanliness += ptr->getCleanliness();
+  exhibit_totals_.dirty += ptr->needsCleaning();
+  exhibit_totals_.by_cleanliness[ptr->getCleanliness()]++;
   return true;
 }
 
@@ -106,21 +171,25 @@ bool Zoo::sellExhibit(Exhibit* exhibit) {
     return false;
   }
 
-  auto it =
-      std::find_if(exhibits_.begin(), exhibits_.end(),
-                   [exhibit](const std::unique_ptr<Exhibit>& ptr) { return ptr.get() == exhibit; });
-  if (it == exhibits_.end()) {
-    std::cout << "Exhibit not found in zoo.\n";
+  if (!ownsExhibit(exhibit)) {
+    sink_->emit({.type = EventType::EXHIBIT_NOT_IN_ZOO});
     return false;
   }
 
-  (*it)->removeAllAnimalsFromExhibit();
+  for (Animal* animal : exhibit->animalView()) {
+    animals_.setLocation(*animal, {});
+  }
+  exhibit->removeAllAnimalsFromExhibit();
 
-  double sell_price = (*it)->getPurchaseCost() / 2.0;
-  std::cout << "Sold " << (*it)->getName() << " for $" << sell_price << "!\n";
+  double sell_price = exhibit->getPurchaseCost() / 2.0;
+  sink_->emit({.type = EventType::EXHIBIT_SOLD, .place = exhibit->getName(), .amount = sell_price});
   balance_ += sell_price;
+  version_++;
 
-  exhibits_.erase(it);
+  exhibit_totals_.cleanliness -= exhibit->getCleanliness();
+  exhibit_totals_.dirty -= exhibit->needsCleaning();
+  exhibit_totals_.by_cleanliness[exhibit->getCleanliness()]--;
+  exhibits_.extract(exhibit->getId());
   return true;
 }
 
@@ -131,39 +200,51 @@ Exhibit* Zoo::getExhibit(size_t index) {
   return exhibits_[index].get();
 }
 
+Exhibit* Zoo::findExhibit(ExhibitId id) const {
+  const std::unique_ptr<Exhibit>* exhibit = exhibits_.find(id);
+  return exhibit ? exhibit->get() : nullptr;
+}
+
 std::vector<Exhibit*> Zoo::getAllExhibits() {
-  std::vector<Exhibit*> exhibits;
-  for (const auto& ptr : exhibits_) {
-    exhibits.push_back(ptr.get());
-  }
-  return exhibits;
+  ExhibitView exhibits = exhibitView();
+  return {exhibits.begin(), exhibits.end()};
 }
 
 std::vector<Exhibit*> Zoo::getExhibitsNeedingCleaning() {
   std::vector<Exhibit*> exhibits;
-  for (const auto& ptr : exhibits_) {
-    if (ptr->needsCleaning()) {
-      exhibits.push_back(ptr.get());
-    }
-  }
+  std::ranges::copy(exhibitsNeedingCleaning(), std::back_inserter(exhibits));
   return exhibits;
 }
 
+ExhibitView Zoo::exhibitView() const {
+  return makePointerView(exhibits_.values());
+}
+
+ExhibitsNeedingCleaning Zoo::exhibitsNeedingCleaning() const {
+  return ExhibitsNeedingCleaning(exhibitView(), NeedsCleaning{});
+}
+
 size_t Zoo::getExhibitCount() const {
   return exhibits_.size();
 }
 
-Exhibit* Zoo::findAnimalLocation(Animal* animal) {
+int Zoo::getMinCleanliness() const {
+  return exhibit_totals_.minCleanliness();
+}
+
+size_t Zoo::getDirtyExhibitCount() const {
+  return exhibit_totals_.dirty;
+}
+
+bool Zoo::ownsExhibit(const Exhibit* exhibit) const {
+  return exhibit && findExhibit(exhibit->getId()) == exhibit;
+}
+
+Exhibit* Zoo::findAnimalLocation(const Animal* animal) const {
   if (!animal) {
     return nullptr;
   }
-
-  for (const auto& ptr : exhibits_) {
-    if (ptr->containsAnimal(animal)) {
-      return ptr.get();
-    }
-  }
-  return nullptr;
+  return findExhibit(animals_.getLocation(*animal));
 }
 
 bool Zoo::addAnimalToExhibit(Animal* animal, Exhibit* exhibit) {
@@ -171,30 +252,35 @@ bool Zoo::addAnimalToExhibit(Animal* animal, Exhibit* exhibit) {
     return false;
   }
 
-  auto it =
-      std::find_if(animals_.begin(), animals_.end(),
-                   [animal](const std::unique_ptr<Animal>& ptr) { return ptr.get() == animal; });
-  if (it == animals_.end()) {
-    std::cout << "Animal not found in zoo.\n";
+  if (!animals_.contains(*animal)) {
+    sink_->emit({.type = EventType::ANIMAL_NOT_IN_ZOO});
     return false;
   }
 
-  if (exhibit->containsAnimal(animal)) {
-    std::cout << animal->getName() << " is already in exhibit " << exhibit->getName() << ".\n ";
+  if (!ownsExhibit(exhibit)) {
+    sink_->emit({.type = EventType::EXHIBIT_NOT_IN_ZOO});
     return false;
   }
 
   // remove animal from current exhibit if needed
   Exhibit* current_exhibit = findAnimalLocation(animal);
+  if (current_exhibit == exhibit) {
+    sink_->emit({.type = EventType::ALREADY_IN_EXHIBIT,
+                 .subject = animal->getName(),
+                 .place = exhibit->getName()});
+    return false;
+  }
   if (current_exhibit) {
     current_exhibit->removeAnimal(animal);
+    animals_.setLocation(*animal, {});
   }
 
   if (!exhibit->addAnimal(animal)) {
-    std::cout << "Failed to add animal to exhibit.\n";
+    sink_->emit({.type = EventType::PLACEMENT_FAILED});
     return false;
   }
 
+  animals_.setLocation(*animal, exhibit->getId(), exhibit->getHabitat());
   return true;
 }
 
@@ -204,11 +290,16 @@ bool Zoo::removeAnimalFromExhibit(Animal* animal, Exhibit* exhibit) {
   }
 
   // check if animal exists in exhibit first
-  if (!exhibit->containsAnimal(animal)) {
+  if (findAnimalLocation(animal) != exhibit) {
     return false;
   }
 
-  return exhibit->removeAnimal(animal);
+  if (!exhibit->removeAnimal(animal)) {
+    return false;
+  }
+
+  animals_.setLocation(*animal, {});
+  return true;
 }
 
 bool Zoo::moveAnimalToExhibit(Animal* animal, Exhibit* exhibit) {
@@ -219,51 +310,52 @@ bool Zoo::moveAnimalToExhibit(Animal* animal, Exhibit* exhibit) {
   // remove animal from its current exhibit
   Exhibit* old_exhibit = findAnimalLocation(animal);
   if (!old_exhibit) {
-    std::cout
-        << "Animal not found in any exhibit! Need to add animal to an exhibit before moving!\n";
+    sink_->emit({.type = EventType::MOVED_ANIMAL_HOMELESS});
     return false;
   }
 
   // check if animal is already in the exhibit
   if (old_exhibit == exhibit) {
-    std::cout << animal->getName() << " is already in exhibit " << exhibit->getName() << ".\n";
+    sink_->emit({.type = EventType::ALREADY_IN_EXHIBIT,
+                 .subject = animal->getName(),
+                 .place = exhibit->getName()});
+    return false;
+  }
+
+  if (!ownsExhibit(exhibit)) {
+    sink_->emit({.type = EventType::EXHIBIT_NOT_IN_ZOO});
     return false;
   }
 
   // see if animal can be added to new exhibit
   if (!exhibit->canAddAnimal()) {
-    std::cout << "Exhibit is full!\n";
+    sink_->emit({.type = EventType::MOVE_TARGET_FULL});
     return false;
   }
 
   old_exhibit->removeAnimal(animal);
   exhibit->addAnimal(animal);
+  animals_.setLocation(*animal, exhibit->getId(), exhibit->getHabitat());
 
-  std::cout << "Moved " << animal->getName() << " to " << exhibit->getName() << ".\n";
+  sink_->emit(
+      {.type = EventType::ANIMAL_MOVED, .subject = animal->getName(), .place = exhibit->getName()});
   return true;
 }
 
 void Zoo::removeDeadAnimals() {
-  std::vector<std::string> dead_animals;
-  for (const auto& animal : animals_) {
-    if (!animal->isAlive()) {
-      dead_animals.push_back(animal->getName() + " the " + animal->getSpecies());
-
-      // remove animal from exhibit if in one
-      Exhibit* exhibit = findAnimalLocation(animal.get());
-      if (exhibit) {
-        exhibit->removeAnimal(animal.get());
-      }
-    }
-  }
+  for (AnimalId id : animals_.deadAnimals(workers_)) {
+    Animal* animal = animals_.find(id);
 
-  animals_.erase(
-      std::remove_if(animals_.begin(), animals_.end(),
-                     [](const std::unique_ptr<Animal>& animal) { return !animal->isAlive(); }),
-      animals_.end());
+    // remove animal from exhibit if in one
+    Exhibit* exhibit = findAnimalLocation(animal);
+    if (exhibit) {
+      exhibit->removeAnimal(animal);
+    }
 
-  for (const auto& name : dead_animals) {
-    std::cout << name << " has died.\n";
+    sink_->emit({.type = EventType::ANIMAL_DIED,
+                 .subject = animal->getName(),
+                 .species = animal->getSpecies()});
+    animals_.remove(id);
   }
 }
 
@@ -277,69 +369,31 @@ bool Zoo::spendMoney(double amount) {
   }
 
   balance_ -= amount;
+  version_++;
   return true;
 }
 
 void Zoo::addMoney(double amount) {
   balance_ += amount;
+  version_++;
 }
 
 void Zoo::updateAnimalStats() {
-  for (const auto& animal : animals_) {
-    animal->updateStatsEndOfDay();  // daily decay
-
-    // apply health penalties for animal neglect
-    // decline health due to starvation
-    int hunger = animal->getHungerLevel();
-    if (hunger >= 90) {
-      animal->updateHealth(-30);
-    } else if (hunger >= 75) {
-      animal->updateHealth(-20);
-    } else if (hunger >= 60) {
-      animal->updateHealth(-15);
-    } else if (hunger >= 45) {
-      animal->updateHealth(-5);
-    }
-
-    // decline health due to unhappiness
-    int happiness = animal->getHappinessLevel();
-    if (happiness < 20) {
-      animal->updateHealth(-15);
-    } else if (happiness < 40) {
-      animal->updateHealth(-5);
-    } else if (happiness < 60) {
-      animal->updateHealth(-2);
-    }
-
-    // decline health due to exhaustion
-    int energy = animal->getEnergyLevel();
-    if (energy < 20) {
-      animal->updateHealth(-10);
-    } else if (energy < 40) {
-      animal->updateHealth(-5);
-    }
+  std::vector<Habitat> exhibit_habitats(exhibits_.capacity(), Habitat::UNKNOWN);
+  for (const auto& exhibit : exhibits_) {
+    exhibit_habitats[exhibit->getId().index] = exhibit->getHabitat();
+  }
 
-    Exhibit* exhibit = findAnimalLocation(animal.get());
-    // habitat matching happiness bonus
-    if (exhibit && exhibit->getType() == animal->getPreferredHabitat()) {
-      animal->updateHappiness(3);
-    } else if (exhibit) {
-      animal->updateHappiness(-2);
-    }
-    // happiness penalty for homeless animals
-    if (!exhibit) {
-      animal->updateHappiness(-15);
-      animal->updateHealth(-5);
-    }
+  animals_.updateEndOfDay(exhibit_habitats, workers_);
+}
 
-    animal->sleep();  // nightly recovery
-  }
+int Zoo::calculateVisitorCount() const {
+  return getMetrics().visitor_count;
 }
 
-int Zoo::calculateVisitorCount() {
+int Zoo::computeVisitorCount(double rating) const {
   int base_visitors = static_cast<int>(getAnimalCount()) * 5;
 
-  double rating = calculateZooRating();
   double rating_multiplier;
   if (rating >= 4.0) {  // excellent, 2x visitors
     rating_multiplier = 2.0;
@@ -357,43 +411,20 @@ int Zoo::calculateVisitorCount() {
 
   int visitors = static_cast<int>(base_visitors * rating_multiplier);
 
-  std::set<std::string> species;
-  for (const auto& animal : animals_) {
-    species.insert(animal->getSpecies());
-  }
-  int diversity_bonus = static_cast<int>(species.size());  // +1 visitor per species
+  int diversity_bonus = speciesMaskCount(animals_.speciesMask());  // +1 visitor per species
 
   int rarity_bonus = 0;
-  for (const auto& animal : animals_) {
-    if (animal->getSpecies() == "Elephant") {
-      rarity_bonus += 6;
-    } else if (animal->getSpecies() == "Bear" || animal->getSpecies() == "Lion") {
-      rarity_bonus += 4;
-    } else if (animal->getSpecies() == "Monkey" || animal->getSpecies() == "Penguin") {
-      rarity_bonus += 2;
-    }
-  }
-
-  int happiness_bonus = 0;
-  for (const auto& animal : animals_) {
-    if (animal->getHappinessLevel() > 80) {
-      happiness_bonus += 2;  // +2 visitors per happy animal
-    }
-  }
-
-  int neglect_penalty = 0;
-  for (const auto& animal : animals_) {
-    if (animal->needsAttention()) {
-      neglect_penalty += 3;  // -3 visitors per neglected animal
-    }
-  }
-
-  int cleanliness_penalty = 0;
-  for (const auto& exhibit : exhibits_) {
-    if (exhibit->needsCleaning()) {
-      cleanliness_penalty += 2;  // -2 visitors per dirty exhibit
-    }
-  }
+  rarity_bonus += 6 * static_cast<int>(animals_.speciesCount(Species::ELEPHANT));
+  rarity_bonus += 4 * static_cast<int>(animals_.speciesCount(Species::BEAR) +
+                                       animals_.speciesCount(Species::LION));
+  rarity_bonus += 2 * static_cast<int>(animals_.speciesCount(Species::MONKEY) +
+                                       animals_.speciesCount(Species::PENGUIN));
+
+  // happy and neglected animals are counted in a single sweep over the stat columns
+  StatCounts counts = animals_.countStats(workers_);
+  int happiness_bonus = 2 * static_cast<int>(counts.happy);  // +2 visitors per happy animal
+  int neglect_penalty = 3 * static_cast<int>(counts.neglected);  // -3 per neglected animal
+  int cleanliness_penalty = 2 * static_cast<int>(exhibit_totals_.dirty);  // -2 per dirty exhibit
 
   int final_visitors = visitors + rarity_bonus + diversity_bonus + happiness_bonus -
                        neglect_penalty - cleanliness_penalty;
@@ -406,10 +437,15 @@ double Zoo::calculateDailyRevenue(int visitor_count) const {
 }
 
 double Zoo::calculateDailyExpenses() const {
+  return getMetrics().daily_expenses;
+}
+
+double Zoo::computeDailyExpenses() const {
   double total = 0.0;
 
   // animal maintenance costs
-  for (const auto& animal : animals_) {
+  for (size_t i = 0; i < animals_.size(); ++i) {
+    const Animal* animal = animals_.at(i);
     total += animal->getMaintenanceCost();
   }
 
@@ -427,87 +463,96 @@ double Zoo::calculateDailyExpenses() const {
 }
 
 // get balance after accounting for projected revenue and expenses
-double Zoo::getProjectedBalance() {
-  // don't use calculateVisitorCount here to avoid circular dependency
+double Zoo::getProjectedBalance() const {
+  return getMetrics().projected_balance;
+}
+
+double Zoo::computeProjectedBalance(double expenses) const {
+  return projectBalance(balance_, expenses);
+}
+
+double Zoo::projectBalance(double balance, double expenses) const {
+  // don't use the visitor count here to avoid circular dependency
   int visitors = static_cast<int>(getAnimalCount() * 5);
   double revenue = calculateDailyRevenue(visitors);
-  double expenses = calculateDailyExpenses();
-  return balance_ + revenue - expenses;
+  return balance + revenue - expenses;
 }
 
-double Zoo::calculateZooRating() {
+// zoo financial health = 5% weight
+static double financialScore(double projected_balance) {
+  if (projected_balance > 3000) {
+    return 0.25;  // max 0.25 stars
+  } else if (projected_balance > 1500) {
+    return 0.15;
+  } else if (projected_balance > 500) {
+    return 0.05;
+  }
+  return 0.0;
+}
+
+double Zoo::calculateZooRating() const {
+  return getMetrics().rating;
+}
+
+double Zoo::computeZooRating(double projected_balance) const {
+  assert(aggregatesMatch());
+
   double happiness_score = 0.0;
   double health_score = 0.0;
 
   if (getAnimalCount() > 0) {
     // animal happiness = 50% weight
-    double total_happiness = 0.0;
-    for (const auto& animal : animals_) {
-      total_happiness += animal->getHappinessLevel();
-    }
-    double avg_happiness = total_happiness / getAnimalCount();
+    double avg_happiness = getAverageHappiness();
     happiness_score = (avg_happiness / 100.0) * 2.5;  // max 2.5 stars
 
     // animal health = 30% weight
-    double total_health = 0.0;
-    for (const auto& animal : animals_) {
-      total_health += animal->getHealthLevel();
-    }
-    double avg_health = total_health / getAnimalCount();
+    double avg_health = getAverageHealth();
     health_score = (avg_health / 100.0) * 1.5;  // max 1.5 stars
   }
 
   // exhibit cleanliness = 15% weight
   double cleanliness_score = 0.5;
   if (getExhibitCount() > 0) {
-    double total_cleanliness = 0.0;
-    for (const auto& exhibit : exhibits_) {
-      total_cleanliness += exhibit->getCleanliness();
-    }
-    double avg_cleanliness = total_cleanliness / getExhibitCount();
+    double avg_cleanliness = getAverageCleanliness();
     cleanliness_score = (avg_cleanliness / 100.0) * 0.75;  // max 0.75 stars
   }
 
-  // zoo financial health = 5% weight
-  double financial_score = 0.0;
-  double projected_balance = getProjectedBalance();
-  if (projected_balance > 3000) {
-    financial_score = 0.25;  // max 0.25 stars
-  } else if (projected_balance > 1500) {
-    financial_score = 0.15;
-  } else if (projected_balance > 500) {
-    financial_score = 0.05;
-  }
+  double financial_score = financialScore(projected_balance);
 
   double total_rating = happiness_score + health_score + cleanliness_score + financial_score;
   return std::max(0.0, std::min(5.0, total_rating));
 }
 
+// state changes bump one of the three counters, so their sum only ever grows
+uint64_t Zoo::getEpoch() const {
+  return version_ + animals_.version() + exhibit_totals_.version;
+}
+
+const ZooMetrics& Zoo::getMetrics() const {
+  uint64_t epoch = getEpoch();
+  if (metrics_epoch_ != epoch) {
+    metrics_.daily_expenses = computeDailyExpenses();
+    metrics_.projected_balance = computeProjectedBalance(metrics_.daily_expenses);
+    metrics_.rating = computeZooRating(metrics_.projected_balance);
+    metrics_.visitor_count = computeVisitorCount(metrics_.rating);
+    metrics_epoch_ = epoch;
+  }
+  return metrics_;
+}
+
 void Zoo::viewZooRatingBreakdown() {
   // animal happiness
-  double total_happiness = 0.0;
-  for (const auto& animal : animals_) {
-    total_happiness += animal->getHappinessLevel();
-  }
-  double avg_happiness = total_happiness / getAnimalCount();
+  double avg_happiness = getAverageHappiness();
   std::cout << "Animal Happiness: " << std::fixed << std::setprecision(1) << avg_happiness
             << "/100\n";
 
   // animal health
-  double total_health = 0.0;
-  for (const auto& animal : animals_) {
-    total_health += animal->getHealthLevel();
-  }
-  double avg_health = total_health / getAnimalCount();
+  double avg_health = getAverageHealth();
   std::cout << "Animal Health: " << std::fixed << std::setprecision(1) << avg_health << "/100\n";
 
   // exhibit cleanliness
   if (getExhibitCount() > 0) {
-    double total_cleanliness = 0.0;
-    for (const auto& exhibit : exhibits_) {
-      total_cleanliness += exhibit->getCleanliness();
-    }
-    double avg_cleanliness = total_cleanliness / getExhibitCount();
+    double avg_cleanliness = getAverageCleanliness();
     std::cout << "Exhibit Cleanliness: " << std::fixed << std::setprecision(1) << avg_cleanliness
               << "/100\n";
   }
@@ -524,6 +569,39 @@ void Zoo::viewZooRatingBreakdown() {
   }
 }
 
+// averages come from running sums kept by the animal store and the exhibit setters
+double Zoo::getAverageHappiness() const {
+  return static_cast<double>(animals_.total(AnimalStat::HAPPINESS)) / getAnimalCount();
+}
+
+double Zoo::getAverageHealth() const {
+  return static_cast<double>(animals_.total(AnimalStat::HEALTH)) / getAnimalCount();
+}
+
+double Zoo::getAverageCleanliness() const {
+  return static_cast<double>(exhibit_totals_.cleanliness) / getExhibitCount();
+}
+
+// recomputes the running sums from scratch, debug builds check them on every rating
+bool Zoo::aggregatesMatch() const {
+  int64_t total_happiness = 0;
+  int64_t total_health = 0;
+  for (size_t i = 0; i < animals_.size(); ++i) {
+    total_happiness += animals_.at(i)->getHappinessLevel();
+    total_health += animals_.at(i)->getHealthLevel();
+  }
+  int64_t total_cleanliness = 0;
+  size_t dirty = 0;
+  for (const auto& exhibit : exhibits_) {
+    total_cleanliness += exhibit->getCleanliness();
+    dirty += exhibit->needsCleaning();
+  }
+
+  return total_happiness == animals_.total(AnimalStat::HAPPINESS) &&
+         total_health == animals_.total(AnimalStat::HEALTH) &&
+         total_cleanliness == exhibit_totals_.cleanliness && dirty == exhibit_totals_.dirty;
+}
+
 std::string Zoo::getRatingMessage(double rating) {
   if (rating >= 4.5) {
     return "(Outstanding)";
@@ -560,13 +638,91 @@ void Zoo::updateBalance() {
   // update balance
   balance_ += revenue;
   balance_ -= expenses;
+  version_++;
 }
 
 void Zoo::advanceDay() {
   day_++;
+  version_++;
+}
+
+void Zoo::setLazyDecay(bool lazy) {
+  animals_.setLazyDecay(lazy);
+}
+
+bool Zoo::isLazyDecay() const {
+  return animals_.isLazyDecay();
+}
+
+void Zoo::fastForward(int days) {
+  while (days > 0) {
+    animals_.markStats();
+    size_t animals_before = getAnimalCount();
+    int64_t cleanliness_before = exhibit_totals_.cleanliness;
+    const ZooMetrics metrics = getMetrics();  // what updateBalance is about to use
+    double revenue = calculateDailyRevenue(metrics.visitor_count);
+    double expenses = metrics.daily_expenses;
+
+    updateBalance();
+    degradeStats();
+    advanceDay();
+    days--;
+
+    // cleanliness only goes down, so an unchanged total means every exhibit is unchanged
+    if (days == 0 || getAnimalCount() != animals_before ||
+        exhibit_totals_.cleanliness != cleanliness_before || animals_.statsChangedSinceMark()) {
+      continue;
+    }
+
+    int repeat = repeatableDays(revenue, expenses, financialScore(metrics.projected_balance), days);
+    balance_ += repeat * (revenue - expenses);
+    day_ += repeat;
+    days -= repeat;
+    version_++;
+  }
+}
+
+// How many of the next `days` repeat a steady day exactly: the rating, and so the visitors,
+// only move with the balance when the projected balance crosses into another financial band.
+// 0 when the closed form could round differently from adding the days up one at a time.
+int Zoo::repeatableDays(double revenue, double expenses, double financial_score, int days) const {
+  // sums of multiples of 1/1024 below 2^42 are exact in a double
+  constexpr double SCALE = 1024.0;
+  constexpr double LIMIT = 4398046511104.0;  // 2^42
+  auto exact = [&](double value) {
+    double scaled = value * SCALE;
+    return scaled == std::floor(scaled) && std::abs(value) < LIMIT;
+  };
+  if (!exact(balance_) || !exact(revenue) || !exact(expenses) ||
+      std::abs(balance_) + days * (std::abs(revenue) + std::abs(expenses)) >= LIMIT) {
+    return 0;
+  }
+
+  // the band can only change once, since the balance moves the same way every day
+  double net = revenue - expenses;
+  auto sameBand = [&](int day) {
+    return financialScore(projectBalance(balance_ + (day - 1) * net, expenses)) == financial_score;
+  };
+  int low = 0;
+  int high = days;
+  while (low < high) {
+    int mid = low + (high - low + 1) / 2;
+    if (sameBand(mid)) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return low;
 }
 
 void Zoo::displayEndOfDaySummary() {
+  ScreenBuffer screen(std::cout);
+  renderEndOfDaySummary(screen);
+  screen.flush();
+}
+
+void Zoo::renderEndOfDaySummary(ScreenBuffer& screen) {
   int dirty_exhibits = 0;
   int sick_animals = 0;
   int hungry_animals = 0;
@@ -575,7 +731,8 @@ void Zoo::displayEndOfDaySummary() {
   int needy_animals = 0;
   int homeless_animals = 0;
 
-  for (const auto& animal : animals_) {
+  for (size_t i = 0; i < animals_.size(); ++i) {
+    const Animal* animal = animals_.at(i);
     if (animal->getHealthLevel() < 50) {
       sick_animals++;
     }
@@ -596,7 +753,7 @@ void Zoo::displayEndOfDaySummary() {
       needy_animals++;
     }
 
-    if (!findAnimalLocation(animal.get())) {
+    if (animals_.getLocation(*animal).isNull()) {
       homeless_animals++;
     }
   }
@@ -611,29 +768,28 @@ void Zoo::displayEndOfDaySummary() {
   double revenue = calculateDailyRevenue(visitors);
   double expenses = calculateDailyExpenses();
 
-  std::cout << "\nAnimals:\n";
-  std::cout << "  Total: " << getAnimalCount() << "\n";
-  std::cout << "  Sick: " << sick_animals << "\n";
-  std::cout << "  Hungry: " << hungry_animals << "\n";
-  std::cout << "  Unhappy: " << unhappy_animals << "\n";
-  std::cout << "  Tired: " << tired_animals << "\n";
-  std::cout << "  Need Attention: " << needy_animals << "\n";
-  std::cout << "  Homeless: " << homeless_animals << "\n";
-
-  std::cout << "\nExhibits:\n";
-  std::cout << "  Total: " << getExhibitCount() << "\n";
-  std::cout << "  Need Cleaning: " << dirty_exhibits << "\n";
-
-  std::cout << "\nStats:\n";
-  std::cout << "  Visitors: " << visitors << "\n";
-  std::cout << "  Revenue : $" << revenue << "\n";
-  std::cout << "  Expenses: $" << expenses << "\n";
-  std::cout << "  Net     : $" << revenue - expenses << "\n";
-  std::cout << "  Bonus   : $" << bonus_earned_ << "\n";
-  std::cout << "  Balance : $" << balance_ << "\n";
+  screen << "\nAnimals:\n";
+  screen << "  Total: " << getAnimalCount() << "\n";
+  screen << "  Sick: " << sick_animals << "\n";
+  screen << "  Hungry: " << hungry_animals << "\n";
+  screen << "  Unhappy: " << unhappy_animals << "\n";
+  screen << "  Tired: " << tired_animals << "\n";
+  screen << "  Need Attention: " << needy_animals << "\n";
+  screen << "  Homeless: " << homeless_animals << "\n";
+
+  screen << "\nExhibits:\n";
+  screen << "  Total: " << getExhibitCount() << "\n";
+  screen << "  Need Cleaning: " << dirty_exhibits << "\n";
+
+  screen << "\nStats:\n";
+  screen << "  Visitors: " << visitors << "\n";
+  screen << "  Revenue : $" << Fixed{revenue, 0} << "\n";
+  screen << "  Expenses: $" << Fixed{expenses, 0} << "\n";
+  screen << "  Net     : $" << Fixed{revenue - expenses, 0} << "\n";
+  screen << "  Bonus   : $" << Fixed{bonus_earned_, 0} << "\n";
+  screen << "  Balance : $" << Fixed{balance_, 0} << "\n";
 
   double rating = calculateZooRating();
-  std::cout << "\nZoo Rating: " << std::fixed << std::setprecision(1) << rating << "/5.0 "
-            << getRatingMessage(rating) << "\n";
-  std::cout << "----------------------------------------------------------------------\n";
+  screen << "\nZoo Rating: " << Fixed{rating, 1} << "/5.0 " << getRatingMessage(rating) << "\n";
+  screen << "----------------------------------------------------------------------\n";
 }
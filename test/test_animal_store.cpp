@@ -0,0 +1,419 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "animal_store.h"
+#include "bear.h"
+#include "lion.h"
+#include "penguin.h"
+#include "rabbit.h"
+
+TEST(AnimalStoreTest, InsertKeepsStats) {
+  AnimalStore store;
+  auto bear = std::make_unique<Bear>("Corduroy", 4);
+  bear->updateHunger(30);
+  bear->updateHappiness(-20);
+  Animal* bear_ptr = bear.get();
+
+  AnimalId id = store.insert(std::move(bear));
+  EXPECT_TRUE(store.contains(*bear_ptr));
+  EXPECT_EQ(store.find(id), bear_ptr);
+  EXPECT_EQ(bear_ptr->getId(), id);
+  EXPECT_EQ(store.size(), 1);
+  EXPECT_EQ(bear_ptr->getHungerLevel(), 30);
+  EXPECT_EQ(bear_ptr->getHappinessLevel(), 80);
+}
+
+TEST(AnimalStoreTest, UpdatesWriteThroughToStore) {
+  AnimalStore store;
+  auto penguin = std::make_unique<Penguin>("Pororo", 8);
+  Animal* penguin_ptr = penguin.get();
+  store.insert(std::move(penguin));
+
+  penguin_ptr->updateHealth(-40);
+  EXPECT_EQ(store.get(0, AnimalStat::HEALTH), 60);
+  EXPECT_EQ(penguin_ptr->getHealthLevel(), 60);
+
+  store.set(0, AnimalStat::ENERGY, 25);
+  EXPECT_EQ(penguin_ptr->getEnergyLevel(), 25);
+}
+
+TEST(AnimalStoreTest, RemoveCopiesStatsBack) {
+  AnimalStore store;
+  AnimalId id = store.insert(std::make_unique<Rabbit>("Miffy", 7));
+  store.find(id)->updateHunger(45);
+
+  std::unique_ptr<Animal> rabbit = store.remove(id);
+  ASSERT_NE(rabbit, nullptr);
+  EXPECT_FALSE(store.contains(*rabbit));
+  EXPECT_EQ(store.find(id), nullptr);
+  EXPECT_TRUE(rabbit->getId().isNull());
+  EXPECT_EQ(store.size(), 0);
+  EXPECT_EQ(rabbit->getHungerLevel(), 45);
+
+  rabbit->updateHunger(10);
+  EXPECT_EQ(rabbit->getHungerLevel(), 55);
+}
+
+TEST(AnimalStoreTest, RemoveMovesLastSlotIntoHole) {
+  AnimalStore store;
+  AnimalId rabbit = store.insert(std::make_unique<Rabbit>("Miffy", 7));
+  AnimalId bear = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  AnimalId lion = store.insert(std::make_unique<Lion>("Simba", 12));
+  store.find(lion)->updateHappiness(-30);
+
+  store.remove(rabbit);
+  EXPECT_EQ(store.size(), 2);
+  EXPECT_EQ(store.at(0), store.find(lion));
+  EXPECT_EQ(store.find(lion)->getHappinessLevel(), 70);
+  EXPECT_EQ(store.get(0, AnimalStat::HAPPINESS), 70);
+
+  store.find(lion)->updateHappiness(10);
+  EXPECT_EQ(store.find(lion)->getHappinessLevel(), 80);
+  EXPECT_EQ(store.find(bear)->getHappinessLevel(), 100);
+}
+
+TEST(AnimalStoreTest, StaleIdDoesNotResolveAfterSlotReuse) {
+  AnimalStore store;
+  AnimalId rabbit = store.insert(std::make_unique<Rabbit>("Miffy", 7));
+  store.remove(rabbit);
+
+  AnimalId bear = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  EXPECT_EQ(bear.index, rabbit.index);
+  EXPECT_NE(bear, rabbit);
+  EXPECT_EQ(store.find(rabbit), nullptr);
+  EXPECT_EQ(store.remove(rabbit), nullptr);
+  EXPECT_EQ(store.size(), 1);
+}
+
+TEST(AnimalStoreTest, LocationFollowsSwapAndPop) {
+  AnimalStore store;
+  AnimalId rabbit = store.insert(std::make_unique<Rabbit>("Miffy", 7));
+  AnimalId bear = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  Animal* bear_ptr = store.find(bear);
+  EXPECT_TRUE(store.getLocation(*bear_ptr).isNull());
+
+  ExhibitId forest{3, 1};
+  store.setLocation(*bear_ptr, forest);
+  std::unique_ptr<Animal> removed = store.remove(rabbit);
+  EXPECT_EQ(store.getLocation(*bear_ptr), forest);
+  EXPECT_TRUE(store.getLocation(*removed).isNull());
+}
+
+TEST(AnimalStoreTest, EndOfDayMatchesPerAnimalUpdate) {
+  AnimalStore store;
+  Animal* housed = store.find(store.insert(std::make_unique<Bear>("Corduroy", 4)));
+  Animal* homeless = store.find(store.insert(std::make_unique<Bear>("Winnie", 8)));
+  Animal* misplaced = store.find(store.insert(std::make_unique<Lion>("Simba", 12)));
+  store.setLocation(*housed, ExhibitId{0, 0});
+  store.setLocation(*misplaced, ExhibitId{0, 0});
+
+  store.updateEndOfDay({Habitat::FOREST});
+
+  // bear: -8 happiness decay, +3 preferred habitat
+  EXPECT_EQ(housed->getHappinessLevel(), 95);
+  EXPECT_EQ(housed->getHungerLevel(), 17);
+  EXPECT_EQ(housed->getEnergyLevel(), 100);
+  EXPECT_EQ(housed->getHealthLevel(), 100);
+
+  // bear: -8 happiness decay, -15 homeless, -5 health homeless, +1 sleep
+  EXPECT_EQ(homeless->getHappinessLevel(), 77);
+  EXPECT_EQ(homeless->getHealthLevel(), 96);
+
+  // lion: -10 happiness decay, -2 wrong habitat
+  EXPECT_EQ(misplaced->getHappinessLevel(), 88);
+  EXPECT_EQ(misplaced->getHungerLevel(), 25);
+  EXPECT_EQ(misplaced->getEnergyLevel(), 100);
+}
+
+TEST(AnimalStoreTest, TracksSpeciesCounts) {
+  AnimalStore store;
+  AnimalId first = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  store.insert(std::make_unique<Bear>("Winnie", 8));
+  store.insert(std::make_unique<Lion>("Simba", 12));
+
+  EXPECT_EQ(store.speciesCount(Species::BEAR), 2);
+  EXPECT_EQ(store.speciesMask(), speciesBit(Species::BEAR) | speciesBit(Species::LION));
+
+  store.remove(first);
+  EXPECT_EQ(store.speciesCount(Species::BEAR), 1);
+  EXPECT_EQ(speciesMaskCount(store.speciesMask()), 2);
+}
+
+TEST(AnimalStoreTest, TotalsFollowEveryWrite) {
+  AnimalStore store;
+  AnimalId bear = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  AnimalId lion = store.insert(std::make_unique<Lion>("Simba", 12));
+  EXPECT_EQ(store.total(AnimalStat::HEALTH), 200);
+
+  store.find(bear)->updateHealth(-30);
+  store.find(lion)->updateHunger(50);
+  EXPECT_EQ(store.total(AnimalStat::HEALTH), 170);
+  EXPECT_EQ(store.total(AnimalStat::HUNGER), 50);
+
+  store.updateEndOfDay({});
+  int64_t happiness = store.find(bear)->getHappinessLevel() + store.find(lion)->getHappinessLevel();
+  EXPECT_EQ(store.total(AnimalStat::HAPPINESS), happiness);
+
+  store.remove(bear);
+  EXPECT_EQ(store.total(AnimalStat::HEALTH), store.find(lion)->getHealthLevel());
+}
+
+TEST(AnimalStoreTest, CountStatsMatchesPerAnimalChecks) {
+  AnimalStore store;
+  Animal* content = store.find(store.insert(std::make_unique<Bear>("Corduroy", 4)));
+  Animal* hungry = store.find(store.insert(std::make_unique<Lion>("Simba", 12)));
+  Animal* tired = store.find(store.insert(std::make_unique<Rabbit>("Miffy", 7)));
+  Animal* unhappy = store.find(store.insert(std::make_unique<Penguin>("Pororo", 8)));
+  hungry->updateHunger(81);
+  tired->updateEnergy(-81);
+  tired->updateHappiness(-20);
+  unhappy->updateHappiness(-81);
+
+  StatCounts counts = store.countStats();
+  size_t happy = 0;
+  size_t neglected = 0;
+  for (const Animal* animal : {content, hungry, tired, unhappy}) {
+    happy += animal->getHappinessLevel() > 80;
+    neglected += animal->needsAttention();
+  }
+  EXPECT_EQ(counts.happy, happy);
+  EXPECT_EQ(counts.neglected, neglected);
+  EXPECT_EQ(counts.happy, 2);
+  EXPECT_EQ(counts.neglected, 3);
+}
+
+namespace {
+
+// exhibit 0 suits the bears, exhibit 1 suits nobody
+const std::vector<Habitat> FILL_HABITATS = {Habitat::FOREST, Habitat::ARCTIC};
+
+// several chunks of animals with seeded stats and placements
+void fillStore(AnimalStore& store, size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> stat(0, 100);
+  std::uniform_int_distribution<int> kind(0, 2);
+  for (size_t i = 0; i < count; ++i) {
+    int which = kind(rng);
+    Animal* animal =
+        which == 0   ? store.find(store.insert(std::make_unique<Bear>("Corduroy", 4)))
+        : which == 1 ? store.find(store.insert(std::make_unique<Lion>("Simba", 12)))
+                     : store.find(store.insert(std::make_unique<Penguin>("Pororo", 8)));
+    for (size_t s = 0; s < ANIMAL_STAT_COUNT; ++s) {
+      store.set(i, static_cast<AnimalStat>(s), stat(rng));
+    }
+    if (which != 2) {
+      store.setLocation(*animal, ExhibitId{static_cast<uint32_t>(which), 0}, FILL_HABITATS[which]);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(AnimalStoreTest, ParallelEndOfDayIsIndependentOfWorkerCount) {
+  const size_t count = 3 * AnimalStore::SWEEP_CHUNK + 123;
+  const std::vector<Habitat>& habitats = FILL_HABITATS;
+
+  AnimalStore serial;
+  fillStore(serial, count);
+  for (int night = 0; night < 5; ++night) {
+    serial.updateEndOfDay(habitats, 1);
+  }
+  std::vector<AnimalId> serial_dead = serial.deadAnimals(1);
+
+  for (size_t workers : {2, 3, 8}) {
+    SCOPED_TRACE(workers);
+    AnimalStore parallel;
+    fillStore(parallel, count);
+    for (int night = 0; night < 5; ++night) {
+      parallel.updateEndOfDay(habitats, workers);
+    }
+
+    for (size_t s = 0; s < ANIMAL_STAT_COUNT; ++s) {
+      auto stat = static_cast<AnimalStat>(s);
+      EXPECT_EQ(parallel.total(stat), serial.total(stat));
+      for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(parallel.get(i, stat), serial.get(i, stat));
+      }
+    }
+    EXPECT_EQ(parallel.deadAnimals(workers), serial_dead);
+  }
+}
+
+TEST(AnimalStoreTest, DeadAnimalsInSlotOrder) {
+  AnimalStore store;
+  AnimalId first = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  store.insert(std::make_unique<Bear>("Winnie", 8));
+  AnimalId third = store.insert(std::make_unique<Lion>("Simba", 12));
+  store.set(2, AnimalStat::HEALTH, 0);
+  store.set(0, AnimalStat::HEALTH, 0);
+
+  std::vector<AnimalId> expected = {first, third};
+  EXPECT_EQ(store.deadAnimals(), expected);
+  EXPECT_EQ(store.deadAnimals(4), expected);
+}
+
+static void expectSameStats(const AnimalStore& expected, const AnimalStore& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t s = 0; s < ANIMAL_STAT_COUNT; ++s) {
+    auto stat = static_cast<AnimalStat>(s);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(actual.get(i, stat), expected.get(i, stat));
+    }
+    EXPECT_EQ(actual.total(stat), expected.total(stat));
+  }
+}
+
+// the running sums, read before any animal is so none of them has been caught up yet
+static void expectSameSums(const AnimalStore& expected, const AnimalStore& actual) {
+  for (size_t s = 0; s < ANIMAL_STAT_COUNT; ++s) {
+    auto stat = static_cast<AnimalStat>(s);
+    EXPECT_EQ(actual.total(stat), expected.total(stat));
+  }
+  ThresholdCounts expected_counts = expected.thresholdCounts();
+  ThresholdCounts actual_counts = actual.thresholdCounts();
+  EXPECT_EQ(actual_counts.sick, expected_counts.sick);
+  EXPECT_EQ(actual_counts.neglected, expected_counts.neglected);
+  EXPECT_EQ(actual_counts.happy, expected_counts.happy);
+  EXPECT_EQ(actual.countStats().happy, expected.countStats().happy);
+}
+
+TEST(AnimalStoreTest, LazyDecayMatchesEager) {
+  const size_t count = 600;
+  AnimalStore eager;
+  AnimalStore lazy;
+  fillStore(eager, count);
+  fillStore(lazy, count);
+  lazy.setLazyDecay(true);
+  EXPECT_TRUE(lazy.isLazyDecay());
+
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<size_t> pick(0, count - 1);
+  for (int night = 0; night < 40; ++night) {
+    SCOPED_TRACE(night);
+    eager.updateEndOfDay(FILL_HABITATS, 1);
+    lazy.updateEndOfDay(FILL_HABITATS, 1);
+    expectSameSums(eager, lazy);
+
+    // touch a few animals the way a day's actions would, leaving the rest unread
+    for (int action = 0; action < 5 && eager.size() > 0; ++action) {
+      size_t slot = pick(rng) % eager.size();
+      int hunger = eager.get(slot, AnimalStat::HUNGER);
+      ASSERT_EQ(lazy.get(slot, AnimalStat::HUNGER), hunger);
+      eager.set(slot, AnimalStat::HUNGER, hunger / 2);
+      lazy.set(slot, AnimalStat::HUNGER, hunger / 2);
+      if (action == 1) {
+        // a night leaves health at least 1, so this only kills if collected before the next
+        eager.set(slot, AnimalStat::HEALTH, 0);
+        lazy.set(slot, AnimalStat::HEALTH, 0);
+      }
+      if (action == 0) {
+        ExhibitId home = night % 2 ? ExhibitId{} : ExhibitId{0, 0};
+        eager.setLocation(*eager.at(slot), home, FILL_HABITATS[0]);
+        lazy.setLocation(*lazy.at(slot), home, FILL_HABITATS[0]);
+      }
+    }
+
+    // every other day's deaths are only collected after the next night
+    if (night % 2) {
+      continue;
+    }
+    std::vector<AnimalId> dead = eager.deadAnimals();
+    ASSERT_EQ(lazy.deadAnimals(), dead);
+    for (AnimalId id : dead) {
+      eager.remove(id);
+      lazy.remove(id);
+    }
+    if (night % 10 == 8) {
+      expectSameStats(eager, lazy);
+    }
+  }
+  EXPECT_LT(eager.size(), count);
+  expectSameStats(eager, lazy);
+
+  lazy.setLazyDecay(false);
+  eager.updateEndOfDay(FILL_HABITATS, 1);
+  lazy.updateEndOfDay(FILL_HABITATS, 1);
+  expectSameStats(eager, lazy);
+}
+
+TEST(AnimalStoreTest, LazyDeadAnimalsRepeatUntilRemoved) {
+  AnimalStore store;
+  store.setLazyDecay(true);
+  AnimalId bear = store.insert(std::make_unique<Bear>("Corduroy", 4));
+  AnimalId lion = store.insert(std::make_unique<Lion>("Simba", 12));
+  store.updateEndOfDay({}, 1);
+  store.set(1, AnimalStat::HEALTH, 0);
+  store.set(0, AnimalStat::HEALTH, 0);
+
+  std::vector<AnimalId> expected = {bear, lion};
+  EXPECT_EQ(store.deadAnimals(), expected);
+  EXPECT_EQ(store.deadAnimals(), expected);
+
+  store.remove(bear);
+  EXPECT_EQ(store.deadAnimals(), std::vector<AnimalId>{lion});
+
+  // the night's recovery brings an animal left at zero back
+  store.updateEndOfDay({}, 1);
+  EXPECT_TRUE(store.deadAnimals().empty());
+  EXPECT_EQ(store.get(0, AnimalStat::HEALTH), 1);
+}
+
+static void expectCountsMatchScan(const AnimalStore& store) {
+  ThresholdCounts scanned;
+  std::array<size_t, PLACEMENT_COUNT> placements{};
+  for (size_t i = 0; i < store.size(); ++i) {
+    const Animal* animal = store.at(i);
+    scanned.sick += animal->getHealthLevel() < AnimalStore::SICK_HEALTH;
+    scanned.neglected += animal->needsAttention();
+    scanned.happy += animal->getHappinessLevel() > 80;
+    ExhibitId exhibit = store.getLocation(*animal);
+    Placement placement = Placement::HOMELESS;
+    if (!exhibit.isNull()) {
+      placement = FILL_HABITATS[exhibit.index] == speciesHabitat(animal->getSpeciesId())
+                      ? Placement::PREFERRED_HABITAT
+                      : Placement::OTHER_HABITAT;
+    }
+    placements[static_cast<size_t>(placement)]++;
+  }
+  ThresholdCounts counts = store.thresholdCounts();
+  EXPECT_EQ(counts.sick, scanned.sick);
+  EXPECT_EQ(counts.neglected, scanned.neglected);
+  EXPECT_EQ(counts.happy, scanned.happy);
+  StatCounts stat_counts = store.countStats();
+  EXPECT_EQ(stat_counts.happy, scanned.happy);
+  EXPECT_EQ(stat_counts.neglected, scanned.neglected);
+  for (size_t p = 0; p < PLACEMENT_COUNT; ++p) {
+    EXPECT_EQ(store.placementCount(static_cast<Placement>(p)), placements[p]);
+  }
+}
+
+TEST(AnimalStoreTest, ThresholdAndPlacementCountsFollowChanges) {
+  for (bool lazy : {false, true}) {
+    SCOPED_TRACE(lazy);
+    const size_t count = 400;
+    AnimalStore store;
+    fillStore(store, count);
+    store.setLazyDecay(lazy);
+    expectCountsMatchScan(store);
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> stat(0, 100);
+    for (int night = 0; night < 10; ++night) {
+      for (int action = 0; action < 20; ++action) {
+        size_t slot = rng() % store.size();
+        store.set(slot, static_cast<AnimalStat>(rng() % ANIMAL_STAT_COUNT), stat(rng));
+        // exhibit 0, exhibit 1 or homeless
+        uint32_t home = rng() % 3;
+        ExhibitId exhibit = home == 2 ? ExhibitId{} : ExhibitId{home, 0};
+        store.setLocation(*store.at(slot), exhibit, FILL_HABITATS[home % 2]);
+      }
+      store.remove(store.at(rng() % store.size())->getId());
+      store.updateEndOfDay(FILL_HABITATS, 2);
+      expectCountsMatchScan(store);
+    }
+  }
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "MissionSystem.h"
+#include "campaign.h"
+#include "monkey.h"
+#include "penguin.h"
+#include "predicate.h"
+#include "zoo.h"
+
+static bool evaluate(std::string_view expression, const MissionVars& vars, const Mission& mission) {
+  PredicateProgram program;
+  std::string error;
+  EXPECT_TRUE(compilePredicate(expression, program, error)) << error;
+  return program.evaluate(vars, mission);
+}
+
+static MissionVars varsWith(MissionVar var, double value) {
+  MissionVars vars{};
+  vars[static_cast<size_t>(var)] = value;
+  return vars;
+}
+
+TEST(PredicateTest, ComparesVariablesAndParameters) {
+  Mission mission(true, "Own 3 animals", MissionType::OWN_X_ANIMALS, 3);
+  mission.float_param = 2.5;
+  MissionVars vars = varsWith(MissionVar::ANIMALS, 3);
+  vars[static_cast<size_t>(MissionVar::RATING)] = 2.5;
+
+  EXPECT_TRUE(evaluate("animals >= param", vars, mission));
+  EXPECT_FALSE(evaluate("animals > param", vars, mission));
+  EXPECT_TRUE(evaluate("animals == 3", vars, mission));
+  EXPECT_TRUE(evaluate("animals != 2", vars, mission));
+  EXPECT_TRUE(evaluate("rating <= amount", vars, mission));
+  EXPECT_FALSE(evaluate("rating < amount", vars, mission));
+  EXPECT_TRUE(evaluate("animals", vars, mission));
+  EXPECT_FALSE(evaluate("exhibits", vars, mission));
+}
+
+TEST(PredicateTest, AndBindsTighterThanOr) {
+  Mission mission(true, "", MissionType::OWN_X_ANIMALS);
+  MissionVars vars = varsWith(MissionVar::ANIMALS, 1);
+
+  // (animals or exhibits) and exhibits would be false
+  EXPECT_TRUE(evaluate("animals or exhibits and exhibits", vars, mission));
+  EXPECT_FALSE(evaluate("not animals or exhibits", vars, mission));
+  EXPECT_TRUE(evaluate("not exhibits and animals", vars, mission));
+  EXPECT_TRUE(evaluate("not not animals", vars, mission));
+}
+
+TEST(PredicateTest, OwnsTestsTheSpeciesMask) {
+  Mission mission(true, "", MissionType::OWN_MEDIUM_ANIMAL);
+  MissionVars vars = varsWith(MissionVar::SPECIES_MASK, speciesBit(Species::MONKEY));
+
+  EXPECT_TRUE(evaluate("owns monkey", vars, mission));
+  EXPECT_FALSE(evaluate("owns penguin", vars, mission));
+  EXPECT_TRUE(evaluate("owns penguin or owns monkey", vars, mission));
+  EXPECT_FALSE(evaluate("owns penguin and owns monkey", vars, mission));
+}
+
+TEST(PredicateTest, ReadsMetricsOnlyWhenNamed) {
+  PredicateProgram program;
+  std::string error;
+  ASSERT_TRUE(compilePredicate("balance >= 100 and fed == param", program, error));
+  EXPECT_FALSE(program.reads_metrics);
+  ASSERT_TRUE(compilePredicate("visitors >= param", program, error));
+  EXPECT_TRUE(program.reads_metrics);
+  EXPECT_TRUE(defaultPredicate(MissionType::BALANCE_AT_LEAST).reads_metrics);
+  EXPECT_FALSE(defaultPredicate(MissionType::NO_SICK_ANIMALS).reads_metrics);
+}
+
+TEST(PredicateTest, RejectsMalformedConditions) {
+  PredicateProgram program;
+  std::string error;
+  EXPECT_FALSE(compilePredicate("", program, error));
+  EXPECT_FALSE(compilePredicate("animals >=", program, error));
+  EXPECT_FALSE(compilePredicate("giraffes > 1", program, error));
+  EXPECT_NE(error.find("giraffes"), std::string::npos);
+  EXPECT_FALSE(compilePredicate("owns dragon", program, error));
+  EXPECT_FALSE(compilePredicate("owns", program, error));
+  EXPECT_FALSE(compilePredicate("animals 3", program, error));
+  EXPECT_FALSE(compilePredicate("species_mask > 0", program, error));
+}
+
+TEST(CampaignTest, StandardCampaignMatchesTheTenDays) {
+  const Campaign& campaign = standardCampaign();
+  ASSERT_EQ(campaign.getDayCount(), 10);
+
+  const size_t mission_counts[] = {4, 4, 4, 5, 5, 5, 5, 5, 5, 8};
+  for (int day = 1; day <= 10; ++day) {
+    EXPECT_EQ(campaign.missionsFor(day).size(), mission_counts[day - 1]) << "day " << day;
+  }
+  EXPECT_TRUE(campaign.missionsFor(0).empty());
+  EXPECT_TRUE(campaign.missionsFor(11).empty());
+
+  const MissionSpec& feed_all = campaign.missionsFor(4)[1];
+  EXPECT_EQ(feed_all.type, MissionType::FEED_X_ANIMALS);
+  EXPECT_TRUE(feed_all.all_animals);
+  EXPECT_EQ(campaign.predicateFor(feed_all), nullptr);
+
+  const MissionSpec& balance = campaign.missionsFor(1)[3];
+  EXPECT_EQ(balance.type, MissionType::BALANCE_AT_LEAST);
+  EXPECT_FALSE(balance.required);
+  EXPECT_TRUE(balance.end_of_day);
+  EXPECT_DOUBLE_EQ(balance.float_param, 1200.0);
+  EXPECT_EQ(balance.reward, 100);
+}
+
+TEST(CampaignTest, LoadsMissionLines) {
+  Campaign campaign;
+  std::string error;
+  ASSERT_TRUE(campaign.load(R"(
+# a short campaign
+day 1
+required "Buy two animals" own_x_animals 2
+optional "Rating" zoo_rating_above 3.5 reward 50 end_of_day
+
+day 2
+required "Feed everyone" feed_x_animals all when fed >= animals and animals > 0
+)",
+                            error))
+      << error;
+  ASSERT_EQ(campaign.getDayCount(), 2);
+
+  const MissionSpec& animals = campaign.missionsFor(1)[0];
+  EXPECT_EQ(animals.description, "Buy two animals");
+  EXPECT_EQ(animals.int_param, 2);
+  EXPECT_TRUE(animals.required);
+
+  const MissionSpec& rating = campaign.missionsFor(1)[1];
+  EXPECT_FALSE(rating.required);
+  EXPECT_DOUBLE_EQ(rating.float_param, 3.5);
+  EXPECT_EQ(rating.reward, 50);
+  EXPECT_TRUE(rating.end_of_day);
+
+  const MissionSpec& feed = campaign.missionsFor(2)[0];
+  EXPECT_TRUE(feed.all_animals);
+  ASSERT_NE(campaign.predicateFor(feed), nullptr);
+}
+
+TEST(CampaignTest, ReportsTheLineAtFault) {
+  Campaign campaign;
+  std::string error;
+
+  EXPECT_FALSE(campaign.load("day 1\nrequired \"x\" own_x_animals 1\nday 3\n", error));
+  EXPECT_EQ(error.rfind("line 3:", 0), 0u) << error;
+  EXPECT_EQ(campaign.getDayCount(), 0);
+
+  EXPECT_FALSE(campaign.load("day 1\n\nrequired \"x\" own_penguins\n", error));
+  EXPECT_EQ(error.rfind("line 3:", 0), 0u) << error;
+  EXPECT_NE(error.find("own_penguins"), std::string::npos);
+
+  EXPECT_FALSE(campaign.load("day 1\nrequired \"x\" own_x_species\n", error));
+  EXPECT_EQ(error.rfind("line 2:", 0), 0u) << error;
+
+  EXPECT_FALSE(campaign.load("required \"x\" own_elephant\n", error));
+  EXPECT_EQ(error.rfind("line 1:", 0), 0u) << error;
+
+  EXPECT_FALSE(campaign.load("day 1\nrequired \"x\" own_elephant when owns\n", error));
+  EXPECT_EQ(error.rfind("line 2:", 0), 0u) << error;
+
+  EXPECT_FALSE(campaign.load("# nothing here\n", error));
+  EXPECT_FALSE(campaign.loadFile("/nonexistent/campaign.txt", error));
+}
+
+TEST(CampaignTest, MissionSystemFollowsACustomCampaign) {
+  Campaign campaign;
+  std::string error;
+  ASSERT_TRUE(campaign.load(R"(
+day 1
+required "Own a monkey and a penguin" own_medium_animal when owns monkey and owns penguin
+day 2
+required "Feed everyone" feed_x_animals all
+)",
+                            error))
+      << error;
+
+  Zoo zoo("Test Zoo", 5000.0);
+  MissionSystem mission_system(zoo, campaign);
+  EXPECT_EQ(mission_system.getDayCount(), 2);
+  ASSERT_EQ(mission_system.getMissions().size(), 1u);
+  const Mission& both = mission_system.getMissions()[0];
+
+  auto monkey = std::make_unique<Monkey>("George", 3);
+  Animal* monkey_ptr = monkey.get();
+  zoo.purchaseAnimal(std::move(monkey));
+  mission_system.checkMissions(false);
+  // the type's own check would pass with the monkey alone
+  EXPECT_FALSE(both.completed);
+
+  auto penguin = std::make_unique<Penguin>("Pingu", 2);
+  Animal* penguin_ptr = penguin.get();
+  zoo.purchaseAnimal(std::move(penguin));
+  mission_system.checkMissions(false);
+  EXPECT_TRUE(both.completed);
+  EXPECT_TRUE(mission_system.canAdvanceDay());
+
+  mission_system.setupDailyMissions(2);
+  ASSERT_EQ(mission_system.getMissions().size(), 1u);
+  const Mission& feed = mission_system.getMissions()[0];
+  EXPECT_EQ(feed.int_param, 2);
+
+  mission_system.trackAnimalFed(monkey_ptr);
+  mission_system.checkMissions(false);
+  EXPECT_FALSE(feed.completed);
+  mission_system.trackAnimalFed(penguin_ptr);
+  mission_system.checkMissions(false);
+  EXPECT_TRUE(feed.completed);
+
+  mission_system.setCampaign(standardCampaign());
+  EXPECT_EQ(mission_system.getDayCount(), 10);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "command_script.h"
+#include "game.h"
+#include "player.h"
+
+namespace {
+
+std::vector<std::string_view> tokenize(std::string_view line) {
+  std::vector<std::string_view> tokens;
+  ScriptTokenizer tokenizer(line);
+  std::string_view token;
+  while (tokenizer.next(token)) {
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+// keeps a scripted game's screens out of the test log
+class SilenceCout {
+ public:
+  SilenceCout() : old_(std::cout.rdbuf(sink_.rdbuf())) {}
+  ~SilenceCout() {
+    std::cout.rdbuf(old_);
+  }
+
+  std::string text() const {
+    return sink_.str();
+  }
+
+ private:
+  std::ostringstream sink_;
+  std::streambuf* old_;
+};
+
+}  // namespace
+
+TEST(CommandScriptTest, TokenizerSplitsOnWhitespaceWithoutCopying) {
+  std::string_view line = "  place\tSimba   \"Pride Rock\" # the big one\r";
+  std::vector<std::string_view> tokens = tokenize(line);
+
+  ASSERT_EQ(tokens.size(), 3u);
+  EXPECT_EQ(tokens[0], "place");
+  EXPECT_EQ(tokens[1], "Simba");
+  EXPECT_EQ(tokens[2], "Pride Rock");
+  for (std::string_view token : tokens) {
+    EXPECT_GE(token.data(), line.data());
+    EXPECT_LE(token.data() + token.size(), line.data() + line.size());
+  }
+}
+
+TEST(CommandScriptTest, TokenizerHandlesEdgeCases) {
+  EXPECT_TRUE(tokenize("").empty());
+  EXPECT_TRUE(tokenize("   # only a comment").empty());
+  EXPECT_EQ(tokenize("feed Simba#late"), (std::vector<std::string_view>{"feed", "Simba"}));
+  EXPECT_EQ(tokenize("buy lion \"Simba Jr"),
+            (std::vector<std::string_view>{"buy", "lion", "Simba Jr"}));
+  EXPECT_EQ(tokenize("build arctic \"\""), (std::vector<std::string_view>{"build", "arctic", ""}));
+}
+
+TEST(CommandScriptTest, SplitsScriptIntoLines) {
+  std::string_view script = "buy lion Simba\n\nend";
+  std::vector<std::string_view> lines;
+  std::string_view line;
+  while (nextScriptLine(script, line)) {
+    lines.push_back(line);
+  }
+  EXPECT_EQ(lines, (std::vector<std::string_view>{"buy lion Simba", "", "end"}));
+}
+
+TEST(CommandScriptTest, ParsesVerbsAndArguments) {
+  ScriptCommand command = parseScriptCommand("BUY lion Simba");
+  EXPECT_EQ(command.verb, ScriptVerb::BUY);
+  ASSERT_EQ(command.arg_count, 2u);
+  EXPECT_EQ(command.args[0], "lion");
+  EXPECT_EQ(command.args[1], "Simba");
+
+  EXPECT_EQ(parseScriptCommand("feed Simba").verb, ScriptVerb::FEED);
+  EXPECT_EQ(parseScriptCommand("end").verb, ScriptVerb::END);
+  EXPECT_EQ(parseScriptCommand("   ").verb, ScriptVerb::NONE);
+  EXPECT_EQ(parseScriptCommand("# comment").verb, ScriptVerb::NONE);
+  EXPECT_EQ(scriptVerbName(ScriptVerb::DEMOLISH), "demolish");
+}
+
+TEST(CommandScriptTest, RejectsUnknownVerbsAndWrongArity) {
+  EXPECT_EQ(parseScriptCommand("dance Simba").verb, ScriptVerb::INVALID);
+  EXPECT_EQ(parseScriptCommand("feed").verb, ScriptVerb::INVALID);
+  EXPECT_EQ(parseScriptCommand("feed Simba Nala").verb, ScriptVerb::INVALID);
+  EXPECT_EQ(parseScriptCommand("end now").verb, ScriptVerb::INVALID);
+}
+
+TEST(CommandScriptTest, MatchesSpeciesAndHabitatsIgnoringCase) {
+  EXPECT_EQ(speciesFromScript("lion"), Species::LION);
+  EXPECT_EQ(speciesFromScript("TORTOISE"), Species::TORTOISE);
+  EXPECT_FALSE(speciesFromScript("dragon").has_value());
+  EXPECT_EQ(habitatFromScript("savanna"), Habitat::SAVANNA);
+  EXPECT_EQ(habitatFromScript("Arctic"), Habitat::ARCTIC);
+  EXPECT_EQ(habitatFromScript("unknown"), Habitat::UNKNOWN);
+}
+
+TEST(CommandScriptTest, GameRunsScriptThroughRealActions) {
+  Game game(Player("Bob"), "Script Zoo");
+  std::istringstream script(
+      "# a small first day\n"
+      "buy rabbit Thumper\n"
+      "build grassland Meadow\n"
+      "place Thumper Meadow\n"
+      "feed Thumper\n");
+
+  SilenceCout silence;
+  EXPECT_TRUE(game.runScript(script));
+
+  const Zoo& zoo = game.getZoo();
+  ASSERT_EQ(zoo.animalView().size(), 1u);
+  ASSERT_EQ(zoo.exhibitView().size(), 1u);
+  Animal* thumper = zoo.animalView()[0];
+  EXPECT_EQ(thumper->getName(), "Thumper");
+  EXPECT_EQ(thumper->getSpecies(), "Rabbit");
+  EXPECT_TRUE(zoo.exhibitView()[0]->containsAnimal(thumper));
+  EXPECT_LT(zoo.getBalance(), 2000.0 - 150.0 - 300.0);
+  EXPECT_TRUE(game.isRunning());
+}
+
+TEST(CommandScriptTest, GameReportsBadLinesAndKeepsGoing) {
+  Game game(Player("Bob"), "Script Zoo");
+  std::istringstream script(
+      "buy dragon Smaug\n"
+      "feed Nobody\n"
+      "jump\n"
+      "buy lion Simba\n");
+
+  SilenceCout silence;
+  EXPECT_FALSE(game.runScript(script));
+  EXPECT_EQ(game.getZoo().animalView().size(), 1u);
+  EXPECT_NE(silence.text().find("Line 3: cannot understand \"jump\""), std::string::npos);
+}
+
+TEST(CommandScriptTest, QuitStopsTheScript) {
+  Game game(Player("Bob"), "Script Zoo");
+  std::istringstream script("quit\nbuy lion Simba\n");
+
+  SilenceCout silence;
+  EXPECT_TRUE(game.runScript(script));
+  EXPECT_FALSE(game.isRunning());
+  EXPECT_TRUE(game.getZoo().animalView().empty());
+}
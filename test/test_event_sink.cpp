@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "MissionSystem.h"
+#include "event_sink.h"
+#include "exhibit.h"
+#include "lion.h"
+#include "player.h"
+#include "zoo.h"
+
+namespace {
+
+struct RecordedEvent {
+  EventType type;
+  std::string subject;
+  std::string place;
+  double amount;
+};
+
+class RecordingSink : public EventSink {
+ public:
+  void emit(const ZooEvent& event) override {
+    events.push_back({event.type, std::string(event.subject), std::string(event.place),
+                      event.amount});
+  }
+
+  std::vector<RecordedEvent> events;
+};
+
+}  // namespace
+
+TEST(EventSinkTest, ConsoleSinkReproducesConsoleText) {
+  std::ostringstream out;
+  ConsoleEventSink sink(out);
+  Zoo zoo("SF Zoo", 10000.0);
+  zoo.setEventSink(sink);
+  Player player("Keeper");
+  player.setEventSink(sink);
+
+  zoo.purchaseAnimal(std::make_unique<Lion>("Simba", 5));
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Plains", "Savanna", 2, 500.0, 20.0));
+  Animal* simba = zoo.animalView().back();
+  Exhibit* plains = zoo.exhibitView().back();
+  zoo.addAnimalToExhibit(simba, plains);
+  player.feedAnimal(zoo, simba);
+  player.cleanExhibit(plains);
+
+  EXPECT_EQ(out.str(),
+            "Purchased Simba the Lion for $1000.\n"
+            "Purchased Exhibit Plains for $500.\n"
+            "Added Simba to Exhibit Plains!\n"
+            "Keeper fed Simba the Lion for $40.\n"
+            "Simba the Lion is eating.\n"
+            "Keeper cleaned Plains.\n"
+            "Exhibit Plains has been cleaned!\n");
+}
+
+TEST(EventSinkTest, NullSinkIsSilent) {
+  NullEventSink sink;
+  Zoo zoo("SF Zoo", 10000.0);
+  zoo.setEventSink(sink);
+  Player player("Keeper");
+  player.setEventSink(sink);
+
+  testing::internal::CaptureStdout();
+  zoo.purchaseAnimal(std::make_unique<Lion>("Simba", 5));
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Plains", "Savanna", 2, 500.0, 20.0));
+  Animal* simba = zoo.animalView().back();
+  zoo.addAnimalToExhibit(simba, zoo.exhibitView().back());
+  player.feedAnimal(zoo, simba);
+  player.treatAnimal(zoo, simba);
+  simba->updateHealth(-100);
+  zoo.removeDeadAnimals();
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+}
+
+TEST(EventSinkTest, EventsCarryTheirSubjects) {
+  RecordingSink sink;
+  Zoo zoo("SF Zoo", 10000.0);
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Den", "Forest", 1, 100.0, 5.0));
+  zoo.setEventSink(sink);
+
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Plains", "Savanna", 1, 500.0, 20.0));
+  zoo.purchaseAnimal(std::make_unique<Lion>("Simba", 5));
+  zoo.purchaseAnimal(std::make_unique<Lion>("Nala", 4));
+  Exhibit* plains = zoo.exhibitView().back();
+  zoo.addAnimalToExhibit(zoo.animalView()[0], plains);
+  zoo.addAnimalToExhibit(zoo.animalView()[1], plains);
+  zoo.animalView()[0]->updateHealth(-100);
+  zoo.removeDeadAnimals();
+
+  // exhibits bought before the sink was set report to it as well
+  zoo.exhibitView().front()->clean();
+
+  std::vector<EventType> types;
+  for (const RecordedEvent& event : sink.events) {
+    types.push_back(event.type);
+  }
+  std::vector<EventType> expected = {
+      EventType::EXHIBIT_PURCHASED, EventType::ANIMAL_PURCHASED,    EventType::ANIMAL_PURCHASED,
+      EventType::ANIMAL_ADDED,      EventType::EXHIBIT_AT_CAPACITY, EventType::PLACEMENT_FAILED,
+      EventType::ANIMAL_REMOVED,    EventType::ANIMAL_DIED,         EventType::EXHIBIT_CLEANED,
+  };
+  EXPECT_EQ(types, expected);
+  EXPECT_EQ(sink.events[0].amount, 500.0);
+  EXPECT_EQ(sink.events[3].subject, "Simba");
+  EXPECT_EQ(sink.events[3].place, "Plains");
+  EXPECT_EQ(sink.events[7].subject, "Simba");
+  EXPECT_EQ(sink.events.back().place, "Den");
+}
+
+TEST(EventSinkTest, MissionCompletionGoesToZooSink) {
+  RecordingSink sink;
+  Zoo zoo("SF Zoo", 10000.0);
+  zoo.setEventSink(sink);
+  MissionSystem missions(zoo);
+  missions.setupDailyMissions(1);
+  missions.completeMission(0);
+
+  ASSERT_FALSE(sink.events.empty());
+  EXPECT_EQ(sink.events.back().type, EventType::MISSION_COMPLETED);
+  EXPECT_FALSE(sink.events.back().subject.empty());
+}
@@ -212,3 +212,20 @@ TEST(ExhibitTest, RenameExhibit) {
   exhibit.setName("Penguin Circle");
   EXPECT_EQ(exhibit.getName(), "Penguin Circle");
 }
+
+TEST(ExhibitTest, AnimalViewTracksMembership) {
+  Exhibit exhibit("Penguin Point", "Arctic", 5, 1500.0, 60.0);
+  Penguin penguin1("Ramon", 15);
+  Penguin penguin2("Nestor", 16);
+  exhibit.addAnimal(&penguin1);
+  exhibit.addAnimal(&penguin2);
+
+  std::span<Animal* const> animals = exhibit.animalView();
+  ASSERT_EQ(animals.size(), 2);
+  EXPECT_EQ(animals[0], &penguin1);
+  EXPECT_EQ(animals[1], &penguin2);
+
+  exhibit.removeAnimal(&penguin1);
+  EXPECT_EQ(exhibit.animalView().size(), 1);
+  EXPECT_EQ(exhibit.animalView().front(), &penguin2);
+}
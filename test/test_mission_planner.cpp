@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include "MissionSystem.h"
+#include "exhibit.h"
+#include "lion.h"
+#include "mission_planner.h"
+#include "penguin.h"
+#include "player.h"
+#include "rabbit.h"
+#include "zoo.h"
+
+struct StatChange {
+  int health;
+  int hunger;
+  int happiness;
+  int energy;
+};
+
+static StatChange careChange(Care care) {
+  Player player("Alice");
+  Zoo zoo("SF Zoo");
+  Rabbit rabbit("Judy", 4);
+  // away from the stat limits, so nothing is clamped
+  rabbit.updateHealth(-50);
+  rabbit.updateHunger(50);
+  rabbit.updateHappiness(-50);
+  rabbit.updateEnergy(-50);
+  StatChange before{rabbit.getHealthLevel(), rabbit.getHungerLevel(),
+                    rabbit.getHappinessLevel(), rabbit.getEnergyLevel()};
+
+  switch (care) {
+    case Care::FEED:
+      EXPECT_TRUE(player.feedAnimal(zoo, &rabbit));
+      break;
+    case Care::PLAY:
+      EXPECT_TRUE(player.playWithAnimal(&rabbit));
+      break;
+    case Care::EXERCISE:
+      EXPECT_TRUE(player.exerciseAnimal(&rabbit));
+      break;
+    case Care::TREAT:
+      EXPECT_TRUE(player.treatAnimal(zoo, &rabbit));
+      EXPECT_DOUBLE_EQ(zoo.getBalance(), 2000.0 - TREATMENT_COST);
+      break;
+  }
+  return {rabbit.getHealthLevel() - before.health, rabbit.getHungerLevel() - before.hunger,
+          rabbit.getHappinessLevel() - before.happiness, rabbit.getEnergyLevel() - before.energy};
+}
+
+TEST(MissionPlannerTest, CareEffectsMatchThePlayer) {
+  for (size_t care = 0; care < CARE_COUNT; ++care) {
+    StatChange change = careChange(static_cast<Care>(care));
+    const CareEffect& effect = CARE_EFFECTS[care];
+    EXPECT_EQ(change.health, effect.health) << "care " << care;
+    EXPECT_EQ(change.hunger, effect.hunger) << "care " << care;
+    EXPECT_EQ(change.happiness, effect.happiness) << "care " << care;
+    EXPECT_EQ(change.energy, effect.energy) << "care " << care;
+  }
+
+  Player player("Alice");
+  Rabbit tired("Tired", 4);
+  tired.updateEnergy(-100 + CARE_EFFECTS[static_cast<size_t>(Care::PLAY)].min_energy - 1);
+  EXPECT_FALSE(player.playWithAnimal(&tired));
+  tired.updateEnergy(1);
+  EXPECT_TRUE(player.playWithAnimal(&tired));
+}
+
+// a zoo on day 2 with a rabbit alone in a full grassland exhibit
+static Animal* setUpFullMeadow(Zoo& zoo) {
+  auto rabbit = std::make_unique<Rabbit>("Judy", 4);
+  Animal* rabbit_ptr = rabbit.get();
+  auto meadow = std::make_unique<Exhibit>("Meadow", "Grassland", 1, 300.0, 15.0);
+  Exhibit* meadow_ptr = meadow.get();
+  zoo.purchaseAnimal(std::move(rabbit));
+  zoo.purchaseExhibit(std::move(meadow));
+  zoo.addAnimalToExhibit(rabbit_ptr, meadow_ptr);
+  return rabbit_ptr;
+}
+
+TEST(MissionPlannerTest, MissionsShareTheBalance) {
+  // day 2 wants a second species, a feeding and no homeless animals: the cheapest way is to
+  // sell the one-place meadow ($150), buy a tortoise ($250) and a grassland for both ($300), and
+  // feed the rabbit ($5)
+  Zoo enough("Test Zoo", 450.0 + 405.0);
+  setUpFullMeadow(enough);
+  MissionSystem enough_missions(enough);
+  enough_missions.setupDailyMissions(2);
+  EXPECT_FALSE(enough_missions.checkMissionsImpossible(3));
+
+  Zoo short_by_one("Test Zoo", 450.0 + 404.0);
+  setUpFullMeadow(short_by_one);
+  MissionSystem short_missions(short_by_one);
+  short_missions.setupDailyMissions(2);
+  EXPECT_TRUE(short_missions.checkMissionsImpossible(3));
+}
+
+TEST(MissionPlannerTest, MissionsShareTheActionPoints) {
+  Zoo zoo("Test Zoo", 600.0 + 100.0);
+  auto meadow = std::make_unique<Exhibit>("Meadow", "Grassland", 3, 300.0, 15.0);
+  Exhibit* meadow_ptr = meadow.get();
+  zoo.purchaseExhibit(std::move(meadow));
+  for (const char* name : {"Judy", "Thumper"}) {
+    auto rabbit = std::make_unique<Rabbit>(name, 4);
+    Animal* rabbit_ptr = rabbit.get();
+    zoo.purchaseAnimal(std::move(rabbit));
+    zoo.addAnimalToExhibit(rabbit_ptr, meadow_ptr);
+  }
+
+  // day 4 wants both rabbits fed and one played with, and $100 can't replace a rabbit or the
+  // meadow once sold
+  MissionSystem mission_system(zoo);
+  mission_system.setupDailyMissions(4);
+  mission_system.getMissions().emplace_back(true, "Keep both rabbits",
+                                            MissionType::OWN_X_ANIMALS, 2);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(2));
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(3));
+
+  // an exhibit below 80 cleanliness takes one more
+  meadow_ptr->updateCleanliness(-40);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(3));
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(4));
+}
+
+TEST(MissionPlannerTest, ExhibitTooCleanToCleanButBelowTarget) {
+  Zoo zoo("Test Zoo", 300.0 + 100.0);
+  auto meadow = std::make_unique<Exhibit>("Meadow", "Grassland", 3, 300.0, 15.0);
+  Exhibit* meadow_ptr = meadow.get();
+  zoo.purchaseExhibit(std::move(meadow));
+
+  Campaign campaign;
+  std::string error;
+  ASSERT_TRUE(campaign.load(R"(
+day 1
+required "Clean exhibits" exhibits_cleanliness_at_least_x 80 end_of_day
+required "Own an exhibit" own_x_exhibits 1
+)",
+                            error))
+      << error;
+  MissionSystem mission_system(zoo, campaign);
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+
+  // 75 is below the target, but only exhibits at 70 or less can be cleaned, and selling the
+  // meadow ($150) doesn't buy another
+  meadow_ptr->updateCleanliness(-25);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(20));
+  meadow_ptr->updateCleanliness(-5);
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(1));
+}
+
+TEST(MissionPlannerTest, StarvingAnimalNeedsAFeedingItCanAfford) {
+  Campaign campaign;
+  std::string error;
+  ASSERT_TRUE(campaign.load(R"(
+day 1
+required "No animals need attention" no_animals_need_attention end_of_day
+required "Own a medium animal" own_medium_animal
+)",
+                            error))
+      << error;
+
+  Zoo zoo("Test Zoo", 400.0 + 9.0);
+  auto penguin = std::make_unique<Penguin>("Pingu", 2);
+  Animal* penguin_ptr = penguin.get();
+  zoo.purchaseAnimal(std::move(penguin));
+  penguin_ptr->updateHunger(95);
+
+  // selling the penguin ($200) doesn't buy another medium animal
+  MissionSystem mission_system(zoo, campaign);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(1));  // feeding a penguin costs $10
+  zoo.addMoney(1.0);
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(1));
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(0));
+}
+
+TEST(MissionPlannerTest, SellingAnAnimalPaysForAnExhibit) {
+  Campaign campaign;
+  std::string error;
+  ASSERT_TRUE(campaign.load(R"(
+day 1
+required "Own an exhibit" own_x_exhibits 1
+day 2
+required "Own an exhibit" own_x_exhibits 1
+required "Own a bear or lion" own_special_animal
+)",
+                            error))
+      << error;
+
+  // a grassland is $300 and the lion sells for $500
+  Zoo zoo("Test Zoo", 1000.0 + 100.0);
+  zoo.purchaseAnimal(std::make_unique<Lion>("Simba", 5));
+  MissionSystem mission_system(zoo, campaign);
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+
+  // the lion has to stay
+  mission_system.setupDailyMissions(2);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(0));
+  zoo.addMoney(199.0);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(0));
+  zoo.addMoney(1.0);
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+}
+
+TEST(MissionPlannerTest, SellingAnExhibitPaysForTreatment) {
+  Campaign campaign;
+  std::string error;
+  ASSERT_TRUE(campaign.load(R"(
+day 1
+required "No sick animals" no_sick_animals end_of_day
+required "Own an animal" own_x_animals 1
+day 2
+required "No sick animals" no_sick_animals end_of_day
+required "Own an animal" own_x_animals 1
+required "Own an exhibit" own_x_exhibits 1
+)",
+                            error))
+      << error;
+
+  // the rabbit sells for $75 and the grassland for $150, treatment is $50
+  Zoo zoo("Test Zoo", 150.0 + 300.0);
+  auto rabbit = std::make_unique<Rabbit>("Judy", 4);
+  Animal* rabbit_ptr = rabbit.get();
+  zoo.purchaseAnimal(std::move(rabbit));
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Meadow", "Grassland", 3, 300.0, 15.0));
+  rabbit_ptr->updateHealth(-70);  // exercise alone doesn't fix it
+  MissionSystem mission_system(zoo, campaign);
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(1));
+  // or sell both and buy a healthy rabbit
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+
+  // the grassland has to stay
+  mission_system.setupDailyMissions(2);
+  EXPECT_TRUE(mission_system.checkMissionsImpossible(1));
+
+  Zoo no_exhibit("Test Zoo", 150.0);
+  auto sick = std::make_unique<Rabbit>("Judy", 4);
+  sick->updateHealth(-70);
+  no_exhibit.purchaseAnimal(std::move(sick));
+  MissionSystem no_exhibit_missions(no_exhibit, campaign);
+  EXPECT_TRUE(no_exhibit_missions.checkMissionsImpossible(1));
+}
+
+TEST(MissionPlannerTest, MetMissionsNeedNothing) {
+  Zoo zoo("Test Zoo", 0.0);
+  MissionSystem mission_system(zoo);
+  for (size_t i = 0; i < mission_system.getMissions().size(); ++i) {
+    mission_system.completeMission(i);
+  }
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+
 #include "MissionSystem.h"
 #include "bear.h"
 #include "elephant.h"
@@ -348,6 +350,55 @@ TEST(MissionSystemTest, FeedingSameAnimalTwiceCountsOnce) {
   }
 }
 
+TEST(MissionSystemTest, SoldAnimalStaysCountedAfterItsIdIsReused) {
+  Zoo zoo("SF Zoo");
+  MissionSystem mission_system(zoo);
+
+  auto first = std::make_unique<Rabbit>("Judy", 4);
+  Animal* first_ptr = first.get();
+  zoo.purchaseAnimal(std::move(first));
+  AnimalId first_id = first_ptr->getId();
+  mission_system.trackAnimalFed(first_ptr);
+  zoo.sellAnimal(first_ptr);
+
+  auto second = std::make_unique<Rabbit>("Thumper", 4);
+  Animal* second_ptr = second.get();
+  zoo.purchaseAnimal(std::move(second));
+  ASSERT_EQ(second_ptr->getId().index, first_id.index);
+  mission_system.trackAnimalFed(second_ptr);
+
+  EXPECT_EQ(mission_system.animalsFedToday().size(), 2u);
+  EXPECT_TRUE(mission_system.animalsFedToday().contains(second_ptr->getId()));
+  mission_system.trackAnimalFed(second_ptr);
+  EXPECT_EQ(mission_system.animalsFedToday().size(), 2u);
+
+  auto pen = std::make_unique<Exhibit>("Pen", "Grassland", 2, 300.0, 15.0);
+  Exhibit* pen_ptr = pen.get();
+  zoo.purchaseExhibit(std::move(pen));
+  mission_system.trackExhibitCleaned(pen_ptr);
+  zoo.sellExhibit(pen_ptr);
+  auto meadow = std::make_unique<Exhibit>("Meadow", "Grassland", 2, 300.0, 15.0);
+  Exhibit* meadow_ptr = meadow.get();
+  zoo.purchaseExhibit(std::move(meadow));
+  mission_system.trackExhibitCleaned(meadow_ptr);
+  EXPECT_EQ(mission_system.exhibitsCleanedToday().size(), 2u);
+
+  mission_system.resetDailyTracking();
+  EXPECT_TRUE(mission_system.animalsFedToday().empty());
+  EXPECT_TRUE(mission_system.exhibitsCleanedToday().empty());
+}
+
+TEST(MissionSystemTest, TrackingAnAnimalOutsideTheZooIsIgnored) {
+  Zoo zoo("SF Zoo");
+  MissionSystem mission_system(zoo);
+
+  Rabbit stray("Stray", 3);
+  ASSERT_TRUE(stray.getId().isNull());
+  mission_system.trackAnimalFed(&stray);
+  EXPECT_TRUE(mission_system.animalsFedToday().empty());
+  EXPECT_FALSE(mission_system.animalsFedToday().contains(stray.getId()));
+}
+
 TEST(MissionSystemTest, ResetDailyTracking) {
   Zoo zoo("SF Zoo");
   MissionSystem mission_system(zoo);
@@ -371,7 +422,10 @@ TEST(MissionSystemTest, ResetDailyTracking) {
     }
   }
 
+  EXPECT_TRUE(mission_system.animalsFedToday().contains(lion_ptr->getId()));
+
   mission_system.resetDailyTracking();
+  EXPECT_TRUE(mission_system.animalsFedToday().empty());
   mission_system.setupDailyMissions(6);
   mission_system.checkMissions(false);
 
@@ -800,6 +854,8 @@ TEST(MissionSystemTest, MissionImpossibleCannotTreatNeedyAnimals) {
 
   animal_ptr->updateHappiness(-90);
   mission_system.setupDailyMissions(7);
+  // and two species, which selling the rabbit and exhibits can't buy along with 3 exhibits
+  mission_system.getMissions().emplace_back(true, "Own 2 species", MissionType::OWN_X_SPECIES, 2);
   EXPECT_TRUE(mission_system.checkMissionsImpossible(0));
 }
 
@@ -813,9 +869,44 @@ TEST(MissionSystemTest, MissionImpossibleCannotTreatSickAnimals) {
 
   animal_ptr->updateHealth(-60);
   mission_system.setupDailyMissions(10);
+  // selling the rabbit ($75) doesn't buy another
+  mission_system.getMissions().emplace_back(true, "Own an animal", MissionType::OWN_X_ANIMALS, 1);
   EXPECT_TRUE(mission_system.checkMissionsImpossible(0));
 }
 
+TEST(MissionSystemTest, NeedyAnimalThatCannotBeTreatedCanBeSold) {
+  Zoo zoo("SF Zoo", 2250.0);  // treatment is $50
+  MissionSystem mission_system(zoo);
+
+  // satisfy day 7 own 3 exhibits mission first
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Grassy", "Grassland", 2, 300.0, 15.0));
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Trees", "Forest", 3, 600.0, 35.0));
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Brrr", "Arctic", 4, 1200.0, 60.0));
+
+  auto animal = std::make_unique<Rabbit>("Miffy", 8);
+  Animal* animal_ptr = animal.get();
+  zoo.purchaseAnimal(std::move(animal));
+
+  animal_ptr->updateHappiness(-90);
+  mission_system.setupDailyMissions(7);
+  // no action left to treat it, but day 7 doesn't need the rabbit kept
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+}
+
+TEST(MissionSystemTest, SickAnimalThatCannotBeTreatedCanBeSold) {
+  Zoo zoo("SF Zoo", 150.0);  // treatment is $50
+  MissionSystem mission_system(zoo);
+
+  auto animal = std::make_unique<Rabbit>("Miffy", 8);
+  Animal* animal_ptr = animal.get();
+  zoo.purchaseAnimal(std::move(animal));
+
+  animal_ptr->updateHealth(-60);
+  mission_system.setupDailyMissions(10);
+  // no action left to treat it, but day 10 doesn't need the rabbit kept
+  EXPECT_FALSE(mission_system.checkMissionsImpossible(0));
+}
+
 TEST(MissionSystemTest, MissionImpossibleCannotPurchaseMediumAnimal) {
   Zoo zoo("SF Zoo", 2600.0);  // penguin is $400, monkey is $600
   MissionSystem mission_system(zoo);
@@ -984,6 +1075,93 @@ TEST(MissionSystemTest, CleanlinessThresholdMission) {
   }
 }
 
+static const Mission& findMission(MissionSystem& missions, MissionType type) {
+  for (const Mission& mission : missions.getMissions()) {
+    if (mission.type == type) {
+      return mission;
+    }
+  }
+  throw std::logic_error("mission not offered");
+}
+
+TEST(MissionSystemTest, PlacementAndCleanlinessMissionsFollowChanges) {
+  Zoo zoo("Test Zoo", 5000.0);
+  MissionSystem mission_system(zoo);
+  mission_system.setupDailyMissions(4);
+
+  auto rabbit = std::make_unique<Rabbit>("Judy", 4);
+  Animal* rabbit_ptr = rabbit.get();
+  zoo.purchaseAnimal(std::move(rabbit));
+  auto meadow = std::make_unique<Exhibit>("Meadow", "Grassland", 2, 300.0, 15.0);
+  auto ice = std::make_unique<Exhibit>("Ice", "Arctic", 2, 1200.0, 60.0);
+  Exhibit* meadow_ptr = meadow.get();
+  Exhibit* ice_ptr = ice.get();
+  zoo.purchaseExhibit(std::move(meadow));
+  zoo.purchaseExhibit(std::move(ice));
+
+  const Mission& habitats = findMission(mission_system, MissionType::PREFERRED_HABITATS);
+  const Mission& cleanliness =
+      findMission(mission_system, MissionType::EXHIBITS_CLEANLINESS_AT_LEAST_X);
+
+  mission_system.checkMissions(true);
+  EXPECT_FALSE(habitats.condition_met);
+  EXPECT_TRUE(cleanliness.condition_met);
+
+  zoo.addAnimalToExhibit(rabbit_ptr, ice_ptr);
+  ice_ptr->updateCleanliness(-21);
+  mission_system.checkMissions(true);
+  EXPECT_FALSE(habitats.condition_met);
+  EXPECT_FALSE(cleanliness.condition_met);
+
+  zoo.moveAnimalToExhibit(rabbit_ptr, meadow_ptr);
+  ice_ptr->clean();
+  mission_system.checkMissions(true);
+  EXPECT_TRUE(habitats.condition_met);
+  EXPECT_TRUE(cleanliness.condition_met);
+
+  meadow_ptr->updateCleanliness(-20);
+  zoo.sellExhibit(meadow_ptr);
+  mission_system.checkMissions(true);
+  EXPECT_FALSE(habitats.condition_met);
+  EXPECT_TRUE(cleanliness.condition_met);
+}
+
+TEST(MissionSystemTest, ContextSummarizesZoo) {
+  Zoo zoo("Test Zoo", 5000.0);
+  MissionSystem mission_system(zoo);
+
+  auto penguin = std::make_unique<Penguin>("Pingu", 4);
+  auto rabbit = std::make_unique<Rabbit>("Judy", 4);
+  Animal* penguin_ptr = penguin.get();
+  Animal* rabbit_ptr = rabbit.get();
+  zoo.purchaseAnimal(std::move(penguin));
+  zoo.purchaseAnimal(std::move(rabbit));
+  zoo.purchaseAnimal(std::make_unique<Lion>("Simba", 6));
+  auto ice = std::make_unique<Exhibit>("Ice", "Arctic", 3, 1200.0, 60.0);
+  auto plains = std::make_unique<Exhibit>("Plains", "Savanna", 3, 1000.0, 50.0);
+  Exhibit* ice_ptr = ice.get();
+  Exhibit* plains_ptr = plains.get();
+  zoo.purchaseExhibit(std::move(ice));
+  zoo.purchaseExhibit(std::move(plains));
+  zoo.addAnimalToExhibit(penguin_ptr, ice_ptr);
+  zoo.addAnimalToExhibit(rabbit_ptr, ice_ptr);
+  plains_ptr->updateCleanliness(-60);
+  rabbit_ptr->updateHealth(-60);
+  penguin_ptr->updateEnergy(-90);
+
+  MissionContext context = mission_system.makeContext();
+  EXPECT_EQ(context.animals, 3u);
+  EXPECT_EQ(context.exhibits, 2u);
+  EXPECT_EQ(context.species, zoo.getSpeciesMask());
+  EXPECT_EQ(context.homeless, 1u);
+  EXPECT_EQ(context.misplaced, 1u);
+  EXPECT_EQ(context.sick, 1u);
+  EXPECT_EQ(context.needy, 1u);
+  EXPECT_EQ(context.min_cleanliness, 40);
+  EXPECT_EQ(context.dirty, 1u);
+  EXPECT_EQ(context.balance, zoo.getBalance());
+}
+
 TEST(MissionSystemTest, AttractVisitorsMission) {
   Zoo zoo("SF Zoo", 5000.0);
   MissionSystem mission_system(zoo);
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "nightly_kernel.h"
+
+namespace {
+
+struct Columns {
+  std::vector<int> health, hunger, happiness, energy;
+  std::vector<Species> species;
+  std::vector<Placement> placement;
+
+  NightlyLanes lanes() {
+    return {health.data(),  hunger.data(),    happiness.data(), energy.data(),
+            species.data(), placement.data(), species.size()};
+  }
+};
+
+// randomized zoo, a range past 0..100 exercises values written straight through set()
+Columns randomColumns(std::mt19937& rng, size_t count, int low, int high) {
+  std::uniform_int_distribution<int> stat(low, high);
+  std::uniform_int_distribution<int> species(0, SPECIES_COUNT - 1);
+  std::uniform_int_distribution<int> placement(0, 2);
+  Columns columns;
+  for (size_t i = 0; i < count; ++i) {
+    columns.health.push_back(stat(rng));
+    columns.hunger.push_back(stat(rng));
+    columns.happiness.push_back(stat(rng));
+    columns.energy.push_back(stat(rng));
+    columns.species.push_back(static_cast<Species>(species(rng)));
+    columns.placement.push_back(static_cast<Placement>(placement(rng)));
+  }
+  return columns;
+}
+
+int clampRef(int value) {
+  return std::clamp(value, KERNEL_MIN_STAT, KERNEL_MAX_STAT);
+}
+
+// straight transcription of the nightly rules, independent of the kernel
+void referenceNight(Columns& c) {
+  for (size_t i = 0; i < c.species.size(); ++i) {
+    const DailyDecay& decay = speciesTraits(c.species[i]).decay;
+    int& health = c.health[i];
+    int& hunger = c.hunger[i];
+    int& happiness = c.happiness[i];
+    int& energy = c.energy[i];
+
+    hunger = clampRef(hunger + decay.hunger);
+    happiness = clampRef(happiness + decay.happiness);
+    energy = clampRef(energy + decay.energy);
+
+    if (hunger >= 90) {
+      health = clampRef(health - 30);
+    } else if (hunger >= 75) {
+      health = clampRef(health - 20);
+    } else if (hunger >= 60) {
+      health = clampRef(health - 15);
+    } else if (hunger >= 45) {
+      health = clampRef(health - 5);
+    }
+
+    if (happiness < 20) {
+      health = clampRef(health - 15);
+    } else if (happiness < 40) {
+      health = clampRef(health - 5);
+    } else if (happiness < 60) {
+      health = clampRef(health - 2);
+    }
+
+    if (energy < 20) {
+      health = clampRef(health - 10);
+    } else if (energy < 40) {
+      health = clampRef(health - 5);
+    }
+
+    if (c.placement[i] == Placement::HOMELESS) {
+      happiness = clampRef(happiness - 15);
+      health = clampRef(health - 5);
+    } else if (c.placement[i] == Placement::PREFERRED_HABITAT) {
+      happiness = clampRef(happiness + 3);
+    } else {
+      happiness = clampRef(happiness - 2);
+    }
+
+    energy = clampRef(energy + 8);
+    health = clampRef(health + 1);
+    hunger = clampRef(hunger + 8);
+  }
+}
+
+void expectColumnsEqual(const Columns& expected, const Columns& actual) {
+  EXPECT_EQ(expected.health, actual.health);
+  EXPECT_EQ(expected.hunger, actual.hunger);
+  EXPECT_EQ(expected.happiness, actual.happiness);
+  EXPECT_EQ(expected.energy, actual.energy);
+}
+
+const KernelIsa ALL_ISAS[] = {KernelIsa::SCALAR, KernelIsa::SSE41, KernelIsa::AVX2};
+
+}  // namespace
+
+TEST(NightlyKernelTest, ScalarIsAlwaysSupported) {
+  EXPECT_TRUE(kernelIsaSupported(KernelIsa::SCALAR));
+  EXPECT_TRUE(kernelIsaSupported(detectKernelIsa()));
+}
+
+TEST(NightlyKernelTest, EveryIsaMatchesReferenceOnRandomZoos) {
+  std::mt19937 rng(20240611);
+  // sizes straddle the 4 and 8 lane widths so the scalar tail is covered too
+  for (size_t count : {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 63, 1000}) {
+    for (int night = 0; night < 8; ++night) {
+      Columns initial = randomColumns(rng, count, 0, 100);
+      Columns expected = initial;
+      referenceNight(expected);
+      for (KernelIsa isa : ALL_ISAS) {
+        if (!kernelIsaSupported(isa)) {
+          continue;
+        }
+        SCOPED_TRACE(kernelIsaName(isa));
+        Columns actual = initial;
+        runNightlyKernel(actual.lanes(), isa);
+        expectColumnsEqual(expected, actual);
+      }
+    }
+  }
+}
+
+TEST(NightlyKernelTest, EveryIsaMatchesReferenceOutOfRange) {
+  std::mt19937 rng(7);
+  Columns initial = randomColumns(rng, 4096, -60, 160);
+  Columns expected = initial;
+  referenceNight(expected);
+  for (KernelIsa isa : ALL_ISAS) {
+    if (!kernelIsaSupported(isa)) {
+      continue;
+    }
+    SCOPED_TRACE(kernelIsaName(isa));
+    Columns actual = initial;
+    runNightlyKernel(actual.lanes(), isa);
+    expectColumnsEqual(expected, actual);
+  }
+}
+
+TEST(NightlyKernelTest, RepeatedNightsStayInLockstep) {
+  std::mt19937 rng(99);
+  Columns expected = randomColumns(rng, 333, 0, 100);
+  Columns dispatched = expected;
+  for (int night = 0; night < 30; ++night) {
+    referenceNight(expected);
+    runNightlyKernel(dispatched.lanes());
+  }
+  expectColumnsEqual(expected, dispatched);
+}
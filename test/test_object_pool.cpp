@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "bear.h"
+#include "exhibit.h"
+#include "lion.h"
+#include "object_pool.h"
+#include "zoo.h"
+
+TEST(ObjectPoolTest, FreedBlocksAreReused) {
+  void* first = poolAllocate(96);
+  poolDeallocate(first, 96);
+  void* second = poolAllocate(90);
+  EXPECT_EQ(first, second);
+  poolDeallocate(second, 90);
+}
+
+TEST(ObjectPoolTest, AnimalsComeFromThePool) {
+  PoolStats before = poolStats();
+  auto lion = std::make_unique<Lion>("Simba", 12);
+  auto exhibit = std::make_unique<Exhibit>("Savanna", "Savanna", 4, 1000.0, 50.0);
+  EXPECT_EQ(poolStats().allocations, before.allocations + 2);
+
+  lion.reset();
+  exhibit.reset();
+  EXPECT_EQ(poolStats().deallocations, before.deallocations + 2);
+}
+
+TEST(ObjectPoolTest, SteadyStatePurchasesDoNotAllocateChunks) {
+  Zoo zoo("SF Zoo", 1e9);
+  for (int i = 0; i < 200; ++i) {
+    zoo.purchaseAnimal(std::make_unique<Bear>("Winnie", 8));
+  }
+
+  // churn through more animals than a chunk holds once the pool has warmed up
+  PoolStats warm = poolStats();
+  for (int i = 0; i < 1000; ++i) {
+    zoo.sellAnimal(zoo.animalView().back());
+    zoo.purchaseAnimal(std::make_unique<Bear>("Winnie", 8));
+  }
+  PoolStats after = poolStats();
+  EXPECT_EQ(after.chunk_allocations, warm.chunk_allocations);
+  EXPECT_EQ(after.allocations - warm.allocations, 1000);
+  EXPECT_EQ(after.deallocations - warm.deallocations, 1000);
+}
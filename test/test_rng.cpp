@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <climits>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "game.h"
+#include "player.h"
+#include "rng.h"
+
+TEST(RngTest, SameSeedSameSequence) {
+  Rng a(42);
+  Rng b(42);
+  Rng c(43);
+  bool differs = false;
+  for (int i = 0; i < 1000; ++i) {
+    uint64_t value = a();
+    EXPECT_EQ(value, b());
+    differs |= value != c();
+  }
+  EXPECT_TRUE(differs);
+}
+
+TEST(RngTest, ReseedRestartsTheSequence) {
+  Rng rng(7);
+  std::vector<uint64_t> first = {rng(), rng(), rng()};
+  rng.reseed(7);
+  EXPECT_EQ(first, (std::vector<uint64_t>{rng(), rng(), rng()}));
+  EXPECT_EQ(rng.getSeed(), 7u);
+}
+
+TEST(RngTest, ZeroSeedIsUsable) {
+  Rng rng(0);
+  EXPECT_NE(rng(), 0u);
+  EXPECT_NE(rng(), rng());
+}
+
+TEST(RngTest, RollBetweenCoversRangeInclusively) {
+  Rng rng(1);
+  std::array<int, 6> counts{};
+  for (int i = 0; i < 60000; ++i) {
+    int roll = rng.rollBetween(1, 6);
+    ASSERT_GE(roll, 1);
+    ASSERT_LE(roll, 6);
+    ++counts[roll - 1];
+  }
+  for (int count : counts) {
+    EXPECT_NEAR(count, 10000, 600);
+  }
+
+  EXPECT_EQ(rng.rollBetween(5, 5), 5);
+  for (int i = 0; i < 1000; ++i) {
+    int roll = rng.rollBetween(-3, 2);
+    ASSERT_GE(roll, -3);
+    ASSERT_LE(roll, 2);
+  }
+  int wide = rng.rollBetween(INT_MIN, INT_MAX);
+  EXPECT_GE(wide, INT_MIN);
+}
+
+TEST(RngTest, WorksWithStandardDistributions) {
+  Rng rng(3);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  double value = unit(rng);
+  EXPECT_GE(value, 0.0);
+  EXPECT_LT(value, 1.0);
+}
+
+TEST(RngTest, SeededGamesReplayIdentically) {
+  auto play = [](uint64_t seed) {
+    Game game(Player("Bob"), "Seeded Zoo", seed);
+    std::istringstream script(
+        "buy rabbit Thumper\n"
+        "buy tortoise Shelly\n"
+        "build grassland Meadow\n"
+        "build forest Woods\n");
+    std::ostringstream out;
+    std::streambuf* old = std::cout.rdbuf(out.rdbuf());
+    game.runScript(script);
+    std::cout.rdbuf(old);
+
+    std::vector<int> rolls;
+    for (const Animal* animal : game.getZoo().animalView()) {
+      rolls.push_back(animal->getAge());
+    }
+    for (const Exhibit* exhibit : game.getZoo().exhibitView()) {
+      rolls.push_back(exhibit->getMaxCapacity());
+    }
+    return rolls;
+  };
+
+  EXPECT_EQ(play(2024), play(2024));
+  EXPECT_EQ(play(2024).size(), 4u);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "MissionSystem.h"
+#include "bear.h"
+#include "screen_buffer.h"
+#include "zoo.h"
+
+TEST(ScreenBufferTest, FormatsTextAndNumbers) {
+  std::ostringstream out;
+  ScreenBuffer screen(out);
+  std::string name = "Winnie";
+  screen << "Name: " << name << '\n'
+         << -42 << ' ' << size_t{7} << ' ' << INT64_MAX << '\n'
+         << Fixed{1999.5, 0} << ' ' << Fixed{2.25, 1} << ' ' << Fixed{-0.04, 1} << '\n';
+
+  EXPECT_EQ(out.str(), "");
+  screen.flush();
+  EXPECT_EQ(out.str(), "Name: Winnie\n-42 7 9223372036854775807\n2000 2.2 -0.0\n");
+}
+
+TEST(ScreenBufferTest, FixedMatchesStreamFormatting) {
+  for (double value : {0.0, 0.5, 1.5, 2.5, 1234.49, 1234.5, -87.25, 1e12 + 0.5}) {
+    for (int precision : {0, 1, 2}) {
+      std::ostringstream expected;
+      expected << std::fixed << std::setprecision(precision) << value;
+
+      std::ostringstream out;
+      ScreenBuffer screen(out);
+      screen << Fixed{value, precision};
+      screen.flush();
+      EXPECT_EQ(out.str(), expected.str()) << value << " " << precision;
+    }
+  }
+}
+
+TEST(ScreenBufferTest, FlushEmptiesTheBufferAndLeavesStreamStateAlone) {
+  std::ostringstream out;
+  ScreenBuffer screen(out);
+  screen << "first\n";
+  screen.flush();
+  EXPECT_TRUE(screen.view().empty());
+  screen << "second " << Fixed{3.14159, 2} << "\n";
+  EXPECT_EQ(screen.view(), "second 3.14\n");
+  screen.flush();
+
+  EXPECT_EQ(out.str(), "first\nsecond 3.14\n");
+  out << 2.5;
+  EXPECT_EQ(out.str(), "first\nsecond 3.14\n2.5");
+}
+
+TEST(ScreenBufferTest, EndOfDaySummaryRendersIntoOneScreen) {
+  Zoo zoo("SF Zoo", 5000.0);
+  NullEventSink sink;
+  zoo.setEventSink(sink);
+  zoo.purchaseAnimal(std::make_unique<Bear>("Winnie", 8));
+
+  std::ostringstream out;
+  ScreenBuffer screen(out);
+  zoo.renderEndOfDaySummary(screen);
+  std::string summary(screen.view());
+  EXPECT_NE(summary.find("\nAnimals:\n  Total: 1\n"), std::string::npos);
+  EXPECT_NE(summary.find("  Balance : $4200\n"), std::string::npos);
+  EXPECT_NE(summary.find("\nZoo Rating: "), std::string::npos);
+  EXPECT_EQ(out.str(), "");
+}
+
+TEST(ScreenBufferTest, MissionsRenderIntoTheScreen) {
+  Zoo zoo("SF Zoo");
+  MissionSystem missions(zoo);
+  missions.setupDailyMissions(1);
+
+  std::ostringstream out;
+  ScreenBuffer screen(out);
+  missions.renderMissions(screen, false);
+  EXPECT_EQ(screen.view().substr(0, 16), "\nDAY 1 MISSIONS\n");
+}
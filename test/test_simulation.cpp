@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "simulation.h"
+
+namespace {
+
+size_t total(const auto& counts) {
+  return std::accumulate(counts.begin(), counts.end(), size_t{0});
+}
+
+}  // namespace
+
+TEST(SimulationTest, GameIsReproducibleFromItsSeed) {
+  MissionStrategy strategy;
+  SimulationReport a = simulateGame(strategy, 99);
+  SimulationReport b = simulateGame(strategy, 99);
+
+  EXPECT_EQ(a.games, 1u);
+  EXPECT_EQ(a.outcomes, b.outcomes);
+  EXPECT_EQ(a.scores, b.scores);
+  EXPECT_EQ(a.missions_completed, b.missions_completed);
+  EXPECT_EQ(a.days_played, b.days_played);
+}
+
+TEST(SimulationTest, EveryGameEndsWithOneOutcome) {
+  RandomStrategy strategy;
+  SimulationReport report = simulateGames(strategy, 100, 1, 1);
+
+  EXPECT_EQ(report.games, 100u);
+  EXPECT_EQ(total(report.outcomes), 100u);
+  EXPECT_EQ(total(report.scores), report.outcomes[static_cast<size_t>(GameOutcome::COMPLETED)]);
+  EXPECT_EQ(report.outcomes[static_cast<size_t>(GameOutcome::QUIT)], 0u);
+  EXPECT_LE(report.missions_completed, report.missions_offered);
+}
+
+TEST(SimulationTest, MissionStrategyGetsPastTheFirstDay) {
+  MissionStrategy strategy;
+  SimulationReport report = simulateGames(strategy, 20, 1, 1);
+
+  EXPECT_GE(report.days_played, 20u);
+  EXPECT_GT(report.missions_completed, 0u);
+}
+
+TEST(SimulationTest, ReportDoesNotDependOnThreadCount) {
+  MissionStrategy strategy;
+  SimulationReport serial = simulateGames(strategy, 150, 7, 1);
+  SimulationReport parallel = simulateGames(strategy, 150, 7, 4);
+
+  EXPECT_EQ(serial.outcomes, parallel.outcomes);
+  EXPECT_EQ(serial.scores, parallel.scores);
+  EXPECT_EQ(serial.missions_offered, parallel.missions_offered);
+  EXPECT_EQ(serial.missions_completed, parallel.missions_completed);
+  EXPECT_EQ(serial.days_played, parallel.days_played);
+}
+
+TEST(SimulationTest, StrategiesAreFoundByName) {
+  EXPECT_EQ(makeStrategy("mission")->getName(), "mission");
+  EXPECT_EQ(makeStrategy("random")->getName(), "random");
+  EXPECT_EQ(makeStrategy("psychic"), nullptr);
+}
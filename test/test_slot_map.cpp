@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "slot_map.h"
+
+struct TestTag;
+using TestMap = SlotMap<std::string, TestTag>;
+
+TEST(SlotMapTest, InsertAndFind) {
+  TestMap map;
+  TestMap::Id a = map.insert("a");
+  TestMap::Id b = map.insert("b");
+
+  EXPECT_EQ(map.size(), 2);
+  ASSERT_NE(map.find(a), nullptr);
+  EXPECT_EQ(*map.find(a), "a");
+  EXPECT_EQ(*map.find(b), "b");
+  EXPECT_EQ(map.idAt(1), b);
+}
+
+TEST(SlotMapTest, NullHandleNeverResolves) {
+  TestMap map;
+  map.insert("a");
+
+  TestMap::Id null;
+  EXPECT_TRUE(null.isNull());
+  EXPECT_FALSE(map.contains(null));
+  EXPECT_EQ(map.find(null), nullptr);
+}
+
+TEST(SlotMapTest, ExtractSwapsLastIntoHole) {
+  TestMap map;
+  TestMap::Id a = map.insert("a");
+  TestMap::Id b = map.insert("b");
+  TestMap::Id c = map.insert("c");
+
+  EXPECT_EQ(map.extract(a), "a");
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map[0], "c");
+  EXPECT_EQ(map.idAt(0), c);
+  EXPECT_EQ(*map.find(b), "b");
+  EXPECT_EQ(*map.find(c), "c");
+}
+
+TEST(SlotMapTest, ReusedSlotBumpsGeneration) {
+  TestMap map;
+  TestMap::Id a = map.insert("a");
+  map.extract(a);
+
+  TestMap::Id b = map.insert("b");
+  EXPECT_EQ(b.index, a.index);
+  EXPECT_NE(b.generation, a.generation);
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_EQ(map.find(a), nullptr);
+  EXPECT_EQ(*map.find(b), "b");
+  EXPECT_EQ(map.capacity(), 1);
+}
+
+TEST(HandleSetTest, CountsDistinctHandlesAcrossWords) {
+  using Id = Handle<TestTag>;
+  HandleSet<TestTag> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.insert(Id{3, 0}));
+  EXPECT_TRUE(set.insert(Id{70, 1}));
+  EXPECT_FALSE(set.insert(Id{3, 0}));
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains(Id{70, 1}));
+  EXPECT_FALSE(set.contains(Id{70, 0}));
+  EXPECT_FALSE(set.contains(Id{500, 0}));
+
+  std::vector<uint32_t> indices;
+  set.forEach([&](Id id) { indices.push_back(id.index); });
+  EXPECT_EQ(indices, (std::vector<uint32_t>{3, 70}));
+
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_FALSE(set.contains(Id{3, 0}));
+  EXPECT_TRUE(set.insert(Id{3, 0}));
+
+  // a null handle's index is far past every word, it must not grow the set
+  EXPECT_FALSE(set.insert(Id{}));
+  EXPECT_FALSE(set.contains(Id{}));
+  EXPECT_EQ(set.size(), 1);
+}
+
+TEST(HandleSetTest, NewerGenerationTakesTheBitOver) {
+  TestMap map;
+  HandleSet<TestTag> set;
+  TestMap::Id a = map.insert("a");
+  set.insert(a);
+  map.extract(a);
+
+  TestMap::Id b = map.insert("b");
+  EXPECT_FALSE(set.contains(b));
+  EXPECT_TRUE(set.insert(b));
+  EXPECT_TRUE(set.contains(b));
+  EXPECT_FALSE(set.contains(a));
+  EXPECT_FALSE(set.insert(b));
+  // a is gone from the set but still counted
+  EXPECT_EQ(set.size(), 2);
+
+  std::vector<TestMap::Id> members;
+  set.forEach([&](TestMap::Id id) { members.push_back(id); });
+  ASSERT_EQ(members.size(), 1u);
+  EXPECT_EQ(members[0], b);
+
+  set.clear();
+  EXPECT_TRUE(set.empty());
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "bear.h"
+#include "exhibit.h"
+#include "species.h"
+#include "tortoise.h"
+
+TEST(SpeciesTest, HabitatNamesRoundTrip) {
+  for (Habitat habitat : {Habitat::GRASSLAND, Habitat::FOREST, Habitat::JUNGLE, Habitat::SAVANNA,
+                          Habitat::ARCTIC}) {
+    EXPECT_EQ(habitatFromName(habitatName(habitat)), habitat);
+  }
+}
+
+TEST(SpeciesTest, UnknownExhibitTypeHasNoHabitat) {
+  EXPECT_EQ(habitatFromName("Plains"), Habitat::UNKNOWN);
+  EXPECT_EQ(habitatFromName("forest"), Habitat::UNKNOWN);
+
+  Exhibit exhibit("Fields", "Plains", 4, 300.0, 15.0);
+  EXPECT_EQ(exhibit.getHabitat(), Habitat::UNKNOWN);
+  EXPECT_EQ(exhibit.getType(), "Plains");
+}
+
+TEST(SpeciesTest, AnimalsCarrySpeciesIds) {
+  Bear bear("Corduroy", 4);
+  Tortoise tortoise("Squirt", 80);
+
+  EXPECT_EQ(bear.getSpeciesId(), Species::BEAR);
+  EXPECT_EQ(bear.getSpecies(), "Bear");
+  EXPECT_EQ(bear.getHabitat(), Habitat::FOREST);
+  EXPECT_EQ(tortoise.getHabitat(), Habitat::GRASSLAND);
+
+  Exhibit meadow("Meadow", "Grassland", 4, 300.0, 15.0);
+  EXPECT_EQ(meadow.getHabitat(), tortoise.getHabitat());
+}
+
+TEST(SpeciesTest, MaskCountsDistinctSpecies) {
+  SpeciesMask mask = speciesBit(Species::LION) | speciesBit(Species::PENGUIN);
+  mask |= speciesBit(Species::LION);
+  EXPECT_EQ(speciesMaskCount(mask), 2);
+  EXPECT_EQ(speciesMaskCount(0), 0);
+}
+
+TEST(SpeciesTest, TraitsDriveAnimalConstants) {
+  for (size_t i = 0; i < SPECIES_COUNT; ++i) {
+    Species species = static_cast<Species>(i);
+    const SpeciesTraits& traits = speciesTraits(species);
+    Animal animal("Generic", species, 3);
+
+    EXPECT_EQ(animal.getSpecies(), traits.name);
+    EXPECT_EQ(animal.getHabitat(), traits.habitat);
+    EXPECT_EQ(animal.getPurchaseCost(), traits.purchase_cost);
+    EXPECT_EQ(animal.getFeedingCost(), traits.feeding_cost);
+    EXPECT_EQ(animal.getMaintenanceCost(), traits.maintenance_cost);
+    EXPECT_EQ(animal.getDailyDecay().hunger, traits.decay.hunger);
+  }
+}
+
+TEST(SpeciesTest, WrapperMatchesTableRow) {
+  Tortoise tortoise("Squirt", 80);
+  EXPECT_EQ(tortoise.getPurchaseCost(), 250.0);
+  EXPECT_EQ(tortoise.getDailyDecay().happiness, -6);
+  EXPECT_EQ(&tortoise.getTraits(), &speciesTraits(Species::TORTOISE));
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.h"
+
+TEST(ThreadPoolTest, WorkerCountIsConfigurable) {
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.workerCount(), 3);
+
+  ThreadPool clamped(0);
+  EXPECT_EQ(clamped.workerCount(), 1);
+}
+
+TEST(ThreadPoolTest, SubmittedTasksRunBeforeShutdown) {
+  std::atomic<int> ran{0};
+  {
+    ThreadPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.submit([&] { ran++; });
+    }
+  }
+  EXPECT_EQ(ran.load(), 100);
+}
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+  ThreadPool pool(4);
+  std::vector<std::atomic<int>> visits(10000);
+  pool.parallelFor(visits.size(), 8, [&](size_t i) { visits[i]++; });
+  for (const auto& count : visits) {
+    ASSERT_EQ(count.load(), 1);
+  }
+}
+
+TEST(ThreadPoolTest, SingleThreadRunsInline) {
+  ThreadPool pool(4);
+  std::thread::id caller = std::this_thread::get_id();
+  bool inline_only = true;
+  pool.parallelFor(64, 1, [&](size_t) { inline_only &= std::this_thread::get_id() == caller; });
+  EXPECT_TRUE(inline_only);
+}
+
+TEST(ThreadPoolTest, NestedParallelForCompletes) {
+  ThreadPool pool(2);
+  std::atomic<int> total{0};
+  pool.parallelFor(8, 4, [&](size_t) {
+    pool.parallelFor(8, 4, [&](size_t) { total++; });
+  });
+  EXPECT_EQ(total.load(), 64);
+}
+
+TEST(ThreadPoolTest, TasksSubmittedFromWorkersRun) {
+  std::atomic<int> ran{0};
+  {
+    ThreadPool pool(2);
+    pool.submit([&] {
+      for (int i = 0; i < 10; ++i) {
+        pool.submit([&] { ran++; });
+      }
+    });
+    while (ran.load() < 10) {
+      std::this_thread::yield();
+    }
+  }
+  EXPECT_EQ(ran.load(), 10);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "bear.h"
+#include "event_sink.h"
 #include "exhibit.h"
 #include "penguin.h"
 #include "rabbit.h"
@@ -143,6 +144,43 @@ TEST(ZooTest, GetAllAnimalsFromEmptyZoo) {
   EXPECT_EQ(zoo.getAllAnimals().size(), 0);
 }
 
+TEST(ZooTest, ViewsMatchVectorAccessors) {
+  Zoo zoo("SF Zoo", 5000.0);
+  zoo.purchaseAnimal(std::make_unique<Bear>("Winnie", 8));
+  zoo.purchaseAnimal(std::make_unique<Penguin>("Pororo", 8));
+  zoo.purchaseExhibit(std::make_unique<Exhibit>("Woods", "Forest", 4, 600.0, 35.0));
+
+  AnimalView animals = zoo.animalView();
+  std::vector<Animal*> all_animals = zoo.getAllAnimals();
+  ASSERT_EQ(animals.size(), all_animals.size());
+  for (size_t i = 0; i < animals.size(); ++i) {
+    EXPECT_EQ(animals[i], all_animals[i]);
+  }
+  EXPECT_EQ(zoo.exhibitView().front(), zoo.getExhibit(0));
+}
+
+TEST(ZooTest, FilteredViewsAreLazy) {
+  Zoo zoo("SF Zoo", 5000.0);
+  auto bear = std::make_unique<Bear>("Winnie", 8);
+  Animal* bear_ptr = bear.get();
+  zoo.purchaseAnimal(std::move(bear));
+  zoo.purchaseAnimal(std::make_unique<Penguin>("Pororo", 8));
+  auto exhibit = std::make_unique<Exhibit>("Woods", "Forest", 4, 600.0, 35.0);
+  Exhibit* exhibit_ptr = exhibit.get();
+  zoo.purchaseExhibit(std::move(exhibit));
+
+  EXPECT_TRUE(zoo.animalsNeedingAttention().empty());
+  EXPECT_TRUE(zoo.exhibitsNeedingCleaning().empty());
+
+  bear_ptr->updateHealth(-90);
+  exhibit_ptr->updateCleanliness(-60);
+
+  AnimalsNeedingAttention needy = zoo.animalsNeedingAttention();
+  ASSERT_EQ(std::ranges::distance(needy), 1);
+  EXPECT_EQ(needy.front(), bear_ptr);
+  EXPECT_EQ(zoo.exhibitsNeedingCleaning().front(), exhibit_ptr);
+}
+
 TEST(ZooTest, GetAnimalsNeedingAttention) {
   Zoo zoo("Oakland Zoo");
 
@@ -535,6 +573,46 @@ TEST(ZooTest, FindAnimalLocationNotInAnyExhibit) {
   EXPECT_EQ(zoo.findAnimalLocation(rabbit_ptr), nullptr);
 }
 
+TEST(ZooTest, SellExhibitKeepsLaterAnimalLocations) {
+  Zoo zoo("SF Zoo", 5000.0);
+
+  auto meadow = std::make_unique<Exhibit>("Rabbit Meadow", "Grassland", 2, 300.0, 15.0);
+  Exhibit* meadow_ptr = meadow.get();
+  zoo.purchaseExhibit(std::move(meadow));
+
+  auto forest = std::make_unique<Exhibit>("Bear Habitat", "Forest", 3, 800.0, 35.0);
+  Exhibit* forest_ptr = forest.get();
+  zoo.purchaseExhibit(std::move(forest));
+
+  auto rabbit = std::make_unique<Rabbit>("Miffy", 7);
+  Animal* rabbit_ptr = rabbit.get();
+  zoo.purchaseAnimal(std::move(rabbit));
+
+  auto bear = std::make_unique<Bear>("Corduroy", 4);
+  Animal* bear_ptr = bear.get();
+  zoo.purchaseAnimal(std::move(bear));
+
+  zoo.addAnimalToExhibit(rabbit_ptr, meadow_ptr);
+  zoo.addAnimalToExhibit(bear_ptr, forest_ptr);
+
+  zoo.sellExhibit(meadow_ptr);
+  EXPECT_EQ(zoo.findAnimalLocation(rabbit_ptr), nullptr);
+  EXPECT_EQ(zoo.findAnimalLocation(bear_ptr), forest_ptr);
+}
+
+TEST(ZooTest, CannotAddAnimalToExhibitNotInZoo) {
+  Zoo zoo("SF Zoo");
+
+  auto rabbit = std::make_unique<Rabbit>("Miffy", 7);
+  Animal* rabbit_ptr = rabbit.get();
+  zoo.purchaseAnimal(std::move(rabbit));
+
+  Exhibit exhibit("Rabbit Meadow", "Grassland", 2, 300.0, 15.0);
+  EXPECT_FALSE(zoo.addAnimalToExhibit(rabbit_ptr, &exhibit));
+  EXPECT_EQ(exhibit.getCapacityUsed(), 0);
+  EXPECT_EQ(zoo.findAnimalLocation(rabbit_ptr), nullptr);
+}
+
 TEST(ZooTest, SpendMoney) {
   Zoo zoo("SF Zoo", 3000.0);
 
@@ -689,6 +767,72 @@ TEST(ZooTest, CalculateZooRatingNoAnimals) {
   EXPECT_EQ(zoo.calculateZooRating(), 0.65);
 }
 
+TEST(ZooTest, RatingAveragesFollowMutations) {
+  Zoo zoo("SF Zoo", 10000.0);
+  auto bear = std::make_unique<Bear>("Winnie", 8);
+  Animal* bear_ptr = bear.get();
+  zoo.purchaseAnimal(std::move(bear));
+  auto rabbit = std::make_unique<Rabbit>("Miffy", 7);
+  Animal* rabbit_ptr = rabbit.get();
+  zoo.purchaseAnimal(std::move(rabbit));
+
+  auto forest = std::make_unique<Exhibit>("Woods", "Forest", 4, 600.0, 35.0);
+  Exhibit* forest_ptr = forest.get();
+  zoo.purchaseExhibit(std::move(forest));
+  auto meadow = std::make_unique<Exhibit>("Meadow", "Grassland", 4, 300.0, 15.0);
+  Exhibit* meadow_ptr = meadow.get();
+  zoo.purchaseExhibit(std::move(meadow));
+
+  bear_ptr->updateHappiness(-40);
+  rabbit_ptr->updateHealth(-30);
+  forest_ptr->updateCleanliness(-50);
+  EXPECT_DOUBLE_EQ(zoo.getAverageHappiness(), 80.0);
+  EXPECT_DOUBLE_EQ(zoo.getAverageHealth(), 85.0);
+  EXPECT_DOUBLE_EQ(zoo.getAverageCleanliness(), 75.0);
+
+  zoo.sellAnimal(bear_ptr);
+  zoo.sellExhibit(meadow_ptr);
+  EXPECT_DOUBLE_EQ(zoo.getAverageHappiness(), 100.0);
+  EXPECT_DOUBLE_EQ(zoo.getAverageHealth(), 70.0);
+  EXPECT_DOUBLE_EQ(zoo.getAverageCleanliness(), 50.0);
+
+  forest_ptr->clean();
+  zoo.updateAnimalStats();
+  EXPECT_DOUBLE_EQ(zoo.getAverageCleanliness(), 100.0);
+  EXPECT_DOUBLE_EQ(zoo.getAverageHappiness(), rabbit_ptr->getHappinessLevel());
+  EXPECT_DOUBLE_EQ(zoo.getAverageHealth(), rabbit_ptr->getHealthLevel());
+}
+
+TEST(ZooTest, MetricsRecomputedOnlyAfterStateChange) {
+  Zoo zoo("SF Zoo", 5000.0);
+  auto bear = std::make_unique<Bear>("Winnie", 8);
+  Animal* bear_ptr = bear.get();
+  zoo.purchaseAnimal(std::move(bear));
+  auto exhibit = std::make_unique<Exhibit>("Woods", "Forest", 4, 600.0, 35.0);
+  Exhibit* exhibit_ptr = exhibit.get();
+  zoo.purchaseExhibit(std::move(exhibit));
+
+  uint64_t epoch = zoo.getEpoch();
+  const ZooMetrics* metrics = &zoo.getMetrics();
+  double rating = zoo.calculateZooRating();
+  EXPECT_EQ(zoo.getEpoch(), epoch);
+  EXPECT_EQ(&zoo.getMetrics(), metrics);
+
+  bear_ptr->updateHappiness(-60);
+  EXPECT_NE(zoo.getEpoch(), epoch);
+  EXPECT_LT(zoo.calculateZooRating(), rating);
+
+  epoch = zoo.getEpoch();
+  exhibit_ptr->updateCleanliness(-60);
+  EXPECT_NE(zoo.getEpoch(), epoch);
+  EXPECT_EQ(zoo.calculateVisitorCount(), 5 + 1 + 4 - 2);  // base, species, rarity, dirty
+
+  epoch = zoo.getEpoch();
+  zoo.addMoney(100.0);
+  EXPECT_NE(zoo.getEpoch(), epoch);
+  EXPECT_DOUBLE_EQ(zoo.getProjectedBalance(), zoo.getBalance() + 75.0 - (60.0 + 35.0 + 43.0));
+}
+
 TEST(ZooTest, AdvanceDay) {
   Zoo zoo("SF Zoo");
   auto bear = std::make_unique<Bear>("Winnie", 8);
@@ -702,3 +846,138 @@ TEST(ZooTest, AdvanceDay) {
   zoo.advanceDay();
   EXPECT_EQ(zoo.getDay(), 2);
 }
+
+TEST(ZooTest, WorkerCountIsAtLeastOne) {
+  Zoo zoo("SF Zoo");
+  EXPECT_GE(zoo.getWorkerCount(), 1);
+  zoo.setWorkerCount(0);
+  EXPECT_EQ(zoo.getWorkerCount(), 1);
+  zoo.setWorkerCount(6);
+  EXPECT_EQ(zoo.getWorkerCount(), 6);
+}
+
+// a zoo with an animal in its preferred habitat, one elsewhere and one homeless
+static void stockZoo(Zoo& zoo) {
+  auto savanna = std::make_unique<Exhibit>("Plains", "Savanna", 3, 1000.0, 50.0);
+  auto arctic = std::make_unique<Exhibit>("Ice", "Arctic", 4, 1200.0, 60.0);
+  Exhibit* plains = savanna.get();
+  Exhibit* ice = arctic.get();
+  zoo.purchaseExhibit(std::move(savanna));
+  zoo.purchaseExhibit(std::move(arctic));
+
+  auto penguin = std::make_unique<Penguin>("Pingu", 4);
+  auto bear = std::make_unique<Bear>("Winnie", 8);
+  Animal* pingu = penguin.get();
+  Animal* winnie = bear.get();
+  zoo.purchaseAnimal(std::move(penguin));
+  zoo.purchaseAnimal(std::move(bear));
+  zoo.purchaseAnimal(std::make_unique<Rabbit>("Thumper", 2));
+  zoo.addAnimalToExhibit(pingu, ice);
+  zoo.addAnimalToExhibit(winnie, plains);
+}
+
+static void expectSameZoo(const Zoo& expected, const Zoo& actual) {
+  EXPECT_EQ(expected.getDay(), actual.getDay());
+  EXPECT_EQ(expected.getBalance(), actual.getBalance());
+  ASSERT_EQ(expected.getAnimalCount(), actual.getAnimalCount());
+  for (size_t i = 0; i < expected.getAnimalCount(); ++i) {
+    const Animal* a = expected.animalView()[i];
+    const Animal* b = actual.animalView()[i];
+    EXPECT_EQ(a->getName(), b->getName());
+    EXPECT_EQ(a->getHealthLevel(), b->getHealthLevel());
+    EXPECT_EQ(a->getHungerLevel(), b->getHungerLevel());
+    EXPECT_EQ(a->getHappinessLevel(), b->getHappinessLevel());
+    EXPECT_EQ(a->getEnergyLevel(), b->getEnergyLevel());
+  }
+  ASSERT_EQ(expected.getExhibitCount(), actual.getExhibitCount());
+  for (size_t i = 0; i < expected.getExhibitCount(); ++i) {
+    EXPECT_EQ(expected.exhibitView()[i]->getCleanliness(),
+              actual.exhibitView()[i]->getCleanliness());
+  }
+  EXPECT_EQ(expected.calculateZooRating(), actual.calculateZooRating());
+}
+
+TEST(ZooTest, FastForwardMatchesDayByDay) {
+  NullEventSink sink;
+  for (double balance : {2000.0, 5000.0, 12345.5, -250.0}) {
+    for (int days : {0, 1, 2, 5, 13, 40, 365}) {
+      for (bool lazy : {false, true}) {
+        Zoo looped("Looped", balance);
+        Zoo skipped("Skipped", balance);
+        looped.setEventSink(sink);
+        skipped.setEventSink(sink);
+        looped.setLazyDecay(false);
+        skipped.setLazyDecay(lazy);
+        stockZoo(looped);
+        stockZoo(skipped);
+
+        for (int day = 0; day < days; ++day) {
+          looped.updateBalance();
+          looped.degradeStats();
+          looped.advanceDay();
+        }
+        skipped.fastForward(days);
+
+        SCOPED_TRACE(testing::Message() << "balance " << balance << ", days " << days);
+        SCOPED_TRACE(lazy);
+        expectSameZoo(looped, skipped);
+      }
+    }
+  }
+}
+
+TEST(ZooTest, FastForwardEmptyZooCrossesRatingBands) {
+  Zoo looped("Looped", 3600.0);
+  Zoo skipped("Skipped", 3600.0);
+  for (Zoo* zoo : {&looped, &skipped}) {
+    zoo->purchaseExhibit(std::make_unique<Exhibit>("Field", "Grassland", 2, 300.0, 15.0));
+  }
+
+  for (int day = 0; day < 200; ++day) {
+    looped.updateBalance();
+    looped.degradeStats();
+    looped.advanceDay();
+  }
+  skipped.fastForward(200);
+
+  expectSameZoo(looped, skipped);
+  EXPECT_LT(skipped.getBalance(), 0.0);
+}
+
+TEST(ZooTest, LazyDecayMatchesEager) {
+  NullEventSink sink;
+  Zoo eager("Eager", 5000.0);
+  Zoo lazy("Lazy", 5000.0);
+  for (Zoo* zoo : {&eager, &lazy}) {
+    zoo->setEventSink(sink);
+    stockZoo(*zoo);
+  }
+  eager.setLazyDecay(false);
+  EXPECT_TRUE(lazy.isLazyDecay());
+
+  for (int day = 0; day < 60; ++day) {
+    SCOPED_TRACE(day);
+    if (day == 3) {
+      // move the penguin out of its habitat, house the rabbit and feed the bear
+      for (Zoo* zoo : {&eager, &lazy}) {
+        Animal* pingu = zoo->animalView()[0];
+        Animal* winnie = zoo->animalView()[1];
+        Animal* thumper = zoo->animalView()[2];
+        ASSERT_TRUE(zoo->moveAnimalToExhibit(pingu, zoo->exhibitView()[0]));
+        ASSERT_TRUE(zoo->addAnimalToExhibit(thumper, zoo->exhibitView()[1]));
+        winnie->updateHunger(-50);
+      }
+    }
+    for (Zoo* zoo : {&eager, &lazy}) {
+      zoo->updateBalance();
+      zoo->degradeStats();
+      zoo->removeDeadAnimals();
+      zoo->advanceDay();
+    }
+    ASSERT_EQ(lazy.getAnimalCount(), eager.getAnimalCount());
+    if (day % 7 == 0) {
+      expectSameZoo(eager, lazy);
+    }
+  }
+  expectSameZoo(eager, lazy);
+}